@@ -0,0 +1,255 @@
+#include <cstdint>
+#include <cstring>
+#include <benchmark/benchmark.h>
+#include "ara/com/someip/serializer.h"
+
+namespace bench
+{
+    struct Sample
+    {
+        std::uint16_t id;
+        std::uint32_t timestamp;
+        double value;
+        bool valid;
+    };
+
+    struct Frame
+    {
+        ara::core::String source;
+        ara::core::Vector<Sample> samples;
+        ara::core::Vector<float> spectrum;
+    };
+
+    using Buffer = ara::core::Vector<ara::core::Byte>;
+
+    /**
+     * \brief The serializer a developer would write by hand for Frame, with the same wire format as the
+     *        generic one: big-endian, 4 byte length fields, strings with byte order mark and terminator.
+     * 
+     */
+    namespace manual
+    {
+        inline std::uint8_t* Put32(std::uint8_t *out, std::uint32_t value)
+        {
+            out[0] = static_cast<std::uint8_t>(value >> 24U);
+            out[1] = static_cast<std::uint8_t>(value >> 16U);
+            out[2] = static_cast<std::uint8_t>(value >> 8U);
+            out[3] = static_cast<std::uint8_t>(value);
+            return out + 4;
+        }
+
+        inline std::uint8_t* Put64(std::uint8_t *out, std::uint64_t value)
+        {
+            out = Put32(out, static_cast<std::uint32_t>(value >> 32U));
+            return Put32(out, static_cast<std::uint32_t>(value));
+        }
+
+        inline std::uint32_t Get32(std::uint8_t const *in)
+        {
+            return (static_cast<std::uint32_t>(in[0]) << 24U) | (static_cast<std::uint32_t>(in[1]) << 16U) |
+                   (static_cast<std::uint32_t>(in[2]) << 8U) | static_cast<std::uint32_t>(in[3]);
+        }
+
+        inline std::uint64_t Get64(std::uint8_t const *in)
+        {
+            return (static_cast<std::uint64_t>(Get32(in)) << 32U) | Get32(in + 4);
+        }
+
+        std::size_t Size(Frame const &frame)
+        {
+            return 4U + 3U + frame.source.size() + 1U + 4U + frame.samples.size() * 15U + 4U + frame.spectrum.size() * 4U;
+        }
+
+        std::size_t Serialize(Frame const &frame, std::uint8_t *out, std::size_t capacity)
+        {
+            if (capacity < Size(frame))
+            {
+                return 0U;
+            }
+            std::uint8_t *const begin = out;
+            out = Put32(out, static_cast<std::uint32_t>(3U + frame.source.size() + 1U));
+            *out++ = 0xEFU;
+            *out++ = 0xBBU;
+            *out++ = 0xBFU;
+            std::memcpy(out, frame.source.data(), frame.source.size());
+            out += frame.source.size();
+            *out++ = 0U;
+            out = Put32(out, static_cast<std::uint32_t>(frame.samples.size() * 15U));
+            for (Sample const &sample : frame.samples)
+            {
+                *out++ = static_cast<std::uint8_t>(sample.id >> 8U);
+                *out++ = static_cast<std::uint8_t>(sample.id);
+                out = Put32(out, sample.timestamp);
+                std::uint64_t bits;
+                std::memcpy(&bits, &sample.value, sizeof(bits));
+                out = Put64(out, bits);
+                *out++ = sample.valid ? 1U : 0U;
+            }
+            out = Put32(out, static_cast<std::uint32_t>(frame.spectrum.size() * 4U));
+            for (float element : frame.spectrum)
+            {
+                std::uint32_t bits;
+                std::memcpy(&bits, &element, sizeof(bits));
+                out = Put32(out, bits);
+            }
+            return static_cast<std::size_t>(out - begin);
+        }
+
+        bool Deserialize(std::uint8_t const *in, std::size_t size, Frame &frame)
+        {
+            std::uint8_t const *const end = in + size;
+            if (end - in < 4)
+            {
+                return false;
+            }
+            std::uint32_t length = Get32(in);
+            in += 4;
+            if ((static_cast<std::uint32_t>(end - in) < length) || (length < 4U) || (in[length - 1U] != 0U))
+            {
+                return false;
+            }
+            frame.source.assign(reinterpret_cast<char const*>(in + 3), length - 4U);
+            in += length;
+            if (end - in < 4)
+            {
+                return false;
+            }
+            length = Get32(in);
+            in += 4;
+            if ((static_cast<std::uint32_t>(end - in) < length) || ((length % 15U) != 0U))
+            {
+                return false;
+            }
+            frame.samples.resize(length / 15U);
+            for (Sample &sample : frame.samples)
+            {
+                sample.id = static_cast<std::uint16_t>((in[0] << 8U) | in[1]);
+                sample.timestamp = Get32(in + 2);
+                std::uint64_t const bits = Get64(in + 6);
+                std::memcpy(&sample.value, &bits, sizeof(bits));
+                sample.valid = (in[14] != 0U);
+                in += 15;
+            }
+            if (end - in < 4)
+            {
+                return false;
+            }
+            length = Get32(in);
+            in += 4;
+            if ((static_cast<std::uint32_t>(end - in) < length) || ((length % 4U) != 0U))
+            {
+                return false;
+            }
+            frame.spectrum.resize(length / 4U);
+            for (float &element : frame.spectrum)
+            {
+                std::uint32_t const bits = Get32(in);
+                std::memcpy(&element, &bits, sizeof(bits));
+                in += 4;
+            }
+            return true;
+        }
+    }
+
+    Frame MakeFrame(std::size_t count)
+    {
+        Frame frame;
+        frame.source = "front_radar";
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            frame.samples.push_back(Sample{static_cast<std::uint16_t>(i), static_cast<std::uint32_t>(i * 10U), static_cast<double>(i) * 0.5, (i % 2U) == 0U});
+            frame.spectrum.push_back(static_cast<float>(i) * 0.25F);
+        }
+        return frame;
+    }
+}
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            template <>
+            struct StructTraits<bench::Sample>
+            {
+                using Fields = std::tuple<Field<bench::Sample, std::uint16_t, &bench::Sample::id>,
+                                          Field<bench::Sample, std::uint32_t, &bench::Sample::timestamp>,
+                                          Field<bench::Sample, double, &bench::Sample::value>,
+                                          Field<bench::Sample, bool, &bench::Sample::valid>>;
+            };
+
+            template <>
+            struct StructTraits<bench::Frame>
+            {
+                using Fields = std::tuple<Field<bench::Frame, ara::core::String, &bench::Frame::source>,
+                                          Field<bench::Frame, ara::core::Vector<bench::Sample>, &bench::Frame::samples>,
+                                          Field<bench::Frame, ara::core::Vector<float>, &bench::Frame::spectrum>>;
+            };
+        }
+    }
+}
+
+namespace
+{
+    void BM_SerializeGeneric(benchmark::State &state)
+    {
+        bench::Frame const frame = bench::MakeFrame(static_cast<std::size_t>(state.range(0)));
+        bench::Buffer buffer(ara::com::someip::GetSerializedSize(frame));
+        for (auto _ : state)
+        {
+            auto const written = ara::com::someip::Serialize(frame, ara::core::Span<ara::core::Byte>(buffer));
+            benchmark::DoNotOptimize(written);
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+    }
+
+    void BM_SerializeManual(benchmark::State &state)
+    {
+        bench::Frame const frame = bench::MakeFrame(static_cast<std::size_t>(state.range(0)));
+        ara::core::Vector<std::uint8_t> buffer(bench::manual::Size(frame));
+        for (auto _ : state)
+        {
+            std::size_t const written = bench::manual::Serialize(frame, buffer.data(), buffer.size());
+            benchmark::DoNotOptimize(written);
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+    }
+
+    void BM_DeserializeGeneric(benchmark::State &state)
+    {
+        bench::Frame const frame = bench::MakeFrame(static_cast<std::size_t>(state.range(0)));
+        bench::Buffer buffer(ara::com::someip::GetSerializedSize(frame));
+        ara::com::someip::Serialize(frame, ara::core::Span<ara::core::Byte>(buffer));
+        bench::Frame result;
+        for (auto _ : state)
+        {
+            auto const read = ara::com::someip::Deserialize(ara::core::Span<ara::core::Byte const>(buffer), result);
+            benchmark::DoNotOptimize(read);
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+    }
+
+    void BM_DeserializeManual(benchmark::State &state)
+    {
+        bench::Frame const frame = bench::MakeFrame(static_cast<std::size_t>(state.range(0)));
+        ara::core::Vector<std::uint8_t> buffer(bench::manual::Size(frame));
+        bench::manual::Serialize(frame, buffer.data(), buffer.size());
+        bench::Frame result;
+        for (auto _ : state)
+        {
+            bool const ok = bench::manual::Deserialize(buffer.data(), buffer.size(), result);
+            benchmark::DoNotOptimize(ok);
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+    }
+}
+
+BENCHMARK(BM_SerializeGeneric)->Arg(1)->Arg(64)->Arg(4096);
+BENCHMARK(BM_SerializeManual)->Arg(1)->Arg(64)->Arg(4096);
+BENCHMARK(BM_DeserializeGeneric)->Arg(1)->Arg(64)->Arg(4096);
+BENCHMARK(BM_DeserializeManual)->Arg(1)->Arg(64)->Arg(4096);
@@ -11,7 +11,9 @@
 #ifndef ARA_COM_COM_ERROR_DOMAIN_H_
 #define ARA_COM_COM_ERROR_DOMAIN_H_
 
+#include "ara/core/error_code.h"
 #include "ara/core/error_domain.h"
+#include "ara/core/exception.h"
 
 namespace ara
 {
@@ -30,6 +32,120 @@ namespace ara
             kNetworkBindingFailure = 3, /*< Local failure has been detected by the network
                                             binding. */
         };
+
+        /**
+         * \brief Exception type thrown for errors of the ComErrorDomain.
+         * 
+         */
+        class ComException : public ara::core::Exception
+        {
+        public:
+            /**
+             * \brief Construct a new ComException from an ErrorCode.
+             * 
+             * \param[in] errorCode     the ErrorCode
+             */
+            explicit ComException(ara::core::ErrorCode errorCode) noexcept : ara::core::Exception(errorCode)
+            {
+            }
+        };
+
+        /**
+         * \brief Error domain for errors originating from ara::com and its network bindings.
+         * 
+         * \Unique ID   0x8000’0000’0000’1267
+         */
+        class ComErrorDomain final : public ara::core::ErrorDomain
+        {
+        public:
+            /**
+             * \brief Alias for the error code value enumeration.
+             * 
+             */
+            using Errc = ComErrc;
+
+            /**
+             * \brief Alias for the exception base class.
+             * 
+             */
+            using Exception = ComException;
+
+            /**
+             * \brief Default constructor.
+             * 
+             */
+            constexpr ComErrorDomain() noexcept : ara::core::ErrorDomain(kId)
+            {
+            }
+
+            /**
+             * \brief Return the name of this error domain.
+             * 
+             * \return char const*  "Com"
+             */
+            char const* Name() const noexcept override
+            {
+                return "Com";
+            }
+
+            /**
+             * \brief Translate an error code value into a text message.
+             * 
+             * \param[in] errorCode     the error code value
+             * \return char const*      the text message, never nullptr
+             */
+            char const* Message(ara::core::ErrorDomain::CodeType errorCode) const noexcept override
+            {
+                switch (static_cast<ComErrc>(errorCode))
+                {
+                case ComErrc::kServiceNotAvailable:
+                    return "Service is not available";
+                case ComErrc::kMaxSamplesExceeded:
+                    return "Application holds more SamplePtrs than committed in Subscribe()";
+                case ComErrc::kNetworkBindingFailure:
+                    return "Local failure has been detected by the network binding";
+                default:
+                    return "Unknown error";
+                }
+            }
+
+            /**
+             * \brief Throw a ComException holding the given ErrorCode.
+             * 
+             * \param[in] errorCode     the ErrorCode instance
+             */
+            void ThrowAsException(ara::core::ErrorCode const &errorCode) const noexcept(false) override
+            {
+                throw ComException(errorCode);
+            }
+
+        private:
+            static constexpr ara::core::ErrorDomain::IdType kId = 0x8000000000001267U;
+        };
+
+        /**
+         * \brief Return a reference to the global ComErrorDomain.
+         * 
+         * \return ara::core::ErrorDomain const&    the ComErrorDomain
+         */
+        inline ara::core::ErrorDomain const& GetComErrorDomain() noexcept
+        {
+            static ComErrorDomain const domain;
+            return domain;
+        }
+
+        /**
+         * \brief Creates an instance of ErrorCode within the ComErrorDomain.
+         * 
+         * \param[in] code  Error code number.
+         * \param[in] data  Vendor defined data associated with the error.
+         * 
+         * \return ara::core::ErrorCode     An ErrorCode object.
+         */
+        inline ara::core::ErrorCode MakeErrorCode(ComErrc code, ara::core::ErrorDomain::SupportDataType data) noexcept
+        {
+            return ara::core::ErrorCode(static_cast<ara::core::ErrorDomain::CodeType>(code), GetComErrorDomain(), data);
+        }
     } // namespace com
     
 } // namespace ara// 
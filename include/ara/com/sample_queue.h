@@ -0,0 +1,220 @@
+/**
+ * \file sample_queue.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_COM_SAMPLE_QUEUE_H_
+#define ARA_COM_SAMPLE_QUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "ara/core/span.h"
+
+namespace ara
+{
+    namespace com
+    {
+        /**
+         * \brief Maximum number of subscribers of one event with the shared-memory binding.
+         * 
+         */
+        constexpr std::uint32_t kMaxEventSubscribers = 64U;
+
+        /**
+         * \brief Slot index that refers to no slot, e.g. an unused entry of a held table.
+         * 
+         */
+        constexpr std::uint32_t kNoEventSlot = 0xFFFFFFFFU;
+
+        /**
+         * \brief Life cycle of a subscriber queue.
+         * 
+         */
+        enum class SampleQueueState : uint32_t
+        {
+            kFree = 0,          /*< Not in use; a subscribing proxy claims it by compare-exchange. */
+            kSubscribed = 1,    /*< In use by a subscriber. */
+            kClosing = 2,       /*< The subscriber left or died; the skeleton releases the queued slots and
+                                    frees the queue. */
+        };
+
+        static_assert(ATOMIC_INT_LOCK_FREE == 2, "queue entries are shared between processes");
+        static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "queue indices are shared between processes");
+
+        /**
+         * \brief Control block of the receive queue of one subscriber, placed in the shared segment of the event.
+         * 
+         * The queue is a single-producer single-consumer ring of slot indices. The skeleton is the only writer
+         * of writeIndex, droppedSamples and the entries; the subscribing proxy is the only writer of
+         * readIndex. Both indices count up without wrapping and are masked with capacity - 1, and each lives
+         * on its own cache line, so no cache line is written by both processes. Publishing to a subscriber
+         * with room in its ring is one relaxed store of the slot index plus one release store of writeIndex.
+         * 
+         * When the ring is full, the new sample is not queued for that subscriber and droppedSamples is
+         * incremented; queued entries are never taken away from the subscriber. A subscriber that falls
+         * behind therefore sees a gap followed by the samples sent after it made room again.
+         * 
+         * \note The ring entries follow the control block. capacity is the maxSampleCount of the subscriber
+         *       rounded up to a power of two.
+         */
+        struct SampleQueueHeader
+        {
+            alignas(64) std::atomic<std::uint64_t> writeIndex;  /*< Written by the skeleton only. */
+            std::atomic<std::uint64_t> droppedSamples;          /*< Samples not queued because the ring was
+                                                                    full; written by the skeleton only. */
+            alignas(64) std::atomic<std::uint64_t> readIndex;   /*< Written by the subscriber only. */
+            alignas(64) std::uint32_t capacity;                 /*< Number of entries, a power of two. */
+            std::uint32_t maxSampleCount;                       /*< As given to Subscribe(). */
+            std::atomic<SampleQueueState> state;                /*< Life cycle of the queue. */
+            std::uint32_t entriesOffset;                        /*< Offset of the ring entries from the segment
+                                                                    start. */
+        };
+
+        /**
+         * \brief Writer end of a subscriber queue, used by the skeleton.
+         * 
+         * The writer keeps private copies of writeIndex and of the last readIndex it loaded, so a Push()
+         * to a queue with room does not read the cache line the subscriber writes.
+         * 
+         */
+        class SampleQueueWriter
+        {
+        public:
+            /**
+             * \brief Constructs a writer on a queue.
+             * 
+             * \param[in] header    the control block of the queue
+             * \param[in] entries   the ring entries of the queue, header.capacity of them
+             */
+            SampleQueueWriter(SampleQueueHeader &header, ara::core::Span<std::atomic<std::uint32_t>> entries) noexcept
+                : mHeader{header},
+                  mEntries{entries},
+                  mMask{static_cast<std::uint64_t>(header.capacity) - 1U},
+                  mWriteIndex{header.writeIndex.load(std::memory_order_relaxed)},
+                  mReadIndex{header.readIndex.load(std::memory_order_acquire)}
+            {
+            }
+
+            /**
+             * \brief Appends a slot index unless the ring is full.
+             * 
+             * readIndex is only loaded when the ring looks full from the last loaded value. If the ring is
+             * still full, droppedSamples is incremented and the caller keeps the reference it meant to hand
+             * to the subscriber, so it shall release it. The publisher never waits for a subscriber.
+             * 
+             * \param[in] slotIndex     the index of the sent slot
+             * \return bool     true if the index was queued, false if the ring was full
+             * \note 
+             * \thread safety no
+             */
+            bool Push(std::uint32_t slotIndex) noexcept
+            {
+                if (mWriteIndex - mReadIndex > mMask)
+                {
+                    // Acquire: the subscriber read the entries before it advanced readIndex past them.
+                    mReadIndex = mHeader.readIndex.load(std::memory_order_acquire);
+                    if (mWriteIndex - mReadIndex > mMask)
+                    {
+                        mHeader.droppedSamples.store(mHeader.droppedSamples.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+                        return false;
+                    }
+                }
+                mEntries[static_cast<std::size_t>(mWriteIndex & mMask)].store(slotIndex, std::memory_order_relaxed);
+                ++mWriteIndex;
+                mHeader.writeIndex.store(mWriteIndex, std::memory_order_release);
+                return true;
+            }
+
+        private:
+            SampleQueueHeader &mHeader;                             /*< The control block. */
+            ara::core::Span<std::atomic<std::uint32_t>> mEntries;   /*< The ring entries. */
+            std::uint64_t mMask;                                    /*< capacity - 1. */
+            std::uint64_t mWriteIndex;                              /*< Equal to writeIndex. */
+            std::uint64_t mReadIndex;                               /*< readIndex when last loaded. */
+        };
+
+        /**
+         * \brief Reader end of a subscriber queue, used by the subscribing proxy.
+         * 
+         */
+        class SampleQueueReader
+        {
+        public:
+            /**
+             * \brief Constructs a reader on a queue.
+             * 
+             * \param[in] header    the control block of the queue; the reader advances its readIndex
+             * \param[in] entries   the ring entries of the queue, header.capacity of them
+             */
+            SampleQueueReader(SampleQueueHeader &header, ara::core::Span<std::atomic<std::uint32_t> const> entries) noexcept
+                : mHeader{header},
+                  mEntries{entries},
+                  mMask{static_cast<std::uint64_t>(header.capacity) - 1U},
+                  mReadIndex{header.readIndex.load(std::memory_order_relaxed)}
+            {
+            }
+
+            /**
+             * \brief Returns the number of queued slot indices.
+             * 
+             * \return std::size_t     the number of queued indices
+             * \note 
+             * \thread safety no
+             */
+            std::size_t GetAvailable() const noexcept
+            {
+                return static_cast<std::size_t>(mHeader.writeIndex.load(std::memory_order_acquire) - mReadIndex);
+            }
+
+            /**
+             * \brief Removes up to maxCount slot indices and hands them to a callable.
+             * 
+             * The indices between readIndex and writeIndex are handed to f in order, and then readIndex is
+             * advanced past them with a single release store. Draining n samples thus costs one load and one
+             * store instead of per-sample atomic read-modify-writes. The skeleton does not overwrite an
+             * entry before readIndex has passed it, so f may, for example, enter the index into the held
+             * table of the subscriber before the queue gives it up.
+             * 
+             * \tparam F    a callable with the signature void(std::uint32_t slotIndex) that does not throw
+             * \param[in] f         the callable
+             * \param[in] maxCount  maximum number of indices to remove
+             * \return std::size_t     the number of indices handed to f
+             * \note 
+             * \thread safety no
+             */
+            template <typename F>
+            std::size_t PopBatch(F &&f, std::size_t maxCount) noexcept
+            {
+                std::uint64_t const writeIndex = mHeader.writeIndex.load(std::memory_order_acquire);
+                std::size_t const count = static_cast<std::size_t>(std::min<std::uint64_t>(writeIndex - mReadIndex, maxCount));
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    f(mEntries[static_cast<std::size_t>((mReadIndex + i) & mMask)].load(std::memory_order_relaxed));
+                }
+                if (count > 0U)
+                {
+                    mReadIndex += count;
+                    mHeader.readIndex.store(mReadIndex, std::memory_order_release);
+                }
+                return count;
+            }
+
+        private:
+            SampleQueueHeader &mHeader;                                 /*< The control block. */
+            ara::core::Span<std::atomic<std::uint32_t> const> mEntries; /*< The ring entries. */
+            std::uint64_t mMask;                                        /*< capacity - 1. */
+            std::uint64_t mReadIndex;                                   /*< Equal to readIndex. */
+        };
+    } // namespace com
+    
+} // namespace ara
+
+
+#endif // ARA_COM_SAMPLE_QUEUE_H_
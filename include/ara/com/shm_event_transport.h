@@ -0,0 +1,232 @@
+/**
+ * \file shm_event_transport.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_COM_SHM_EVENT_TRANSPORT_H_
+#define ARA_COM_SHM_EVENT_TRANSPORT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include "ara/com/com_error_domain.h"
+#include "ara/com/sample_queue.h"
+#include "ara/com/types.h"
+#include "ara/core/instance_specifier.h"
+#include "ara/core/result.h"
+
+namespace ara
+{
+    namespace com
+    {
+        /**
+         * \brief Header of a sample slot in the shared segment of an event; the sample follows it, aligned to
+         *        64 bytes.
+         * 
+         */
+        struct alignas(64) EventSlotHeader
+        {
+            std::atomic<std::uint32_t> refCount;    /*< References held by subscriber queues and SamplePtrs. */
+            std::uint32_t nextFree;                 /*< Index of the next free slot while the slot is free. */
+            std::uint64_t sequence;                 /*< Send() counter of the publisher when the slot was sent. */
+        };
+
+        /**
+         * \brief Header at the start of the shared segment of an event.
+         * 
+         * The segment is created by the skeleton ("/ara_com.<service>.<instance>.<event>") and mapped by every
+         * proxy; proxies only write the refCount of slots, and the read cursor and subscriber record of their
+         * own subscription. Free slots form a lock-free stack: freeHead holds the index of the top slot in its
+         * lower 32 bits and a modification tag in its upper 32 bits, which prevents ABA on compare-exchange.
+         */
+        struct EventSegmentHeader
+        {
+            std::uint32_t magic;                    /*< kEventSegmentMagic. */
+            std::uint32_t layoutVersion;            /*< Incremented with incompatible changes. */
+            std::uint32_t slotCount;                /*< Number of sample slots. */
+            std::uint32_t slotSize;                 /*< Bytes per slot including its EventSlotHeader. */
+            std::uint32_t maxSampleCount;           /*< Largest maxSampleCount a subscriber may request. */
+            std::uint32_t maxSubscribers;           /*< Number of subscriber records and queues. */
+            std::uint64_t slotsOffset;              /*< Offset of slot 0 from the segment start. */
+            std::uint64_t queuesOffset;             /*< Offset of the maxSubscribers SampleQueueHeaders from
+                                                        the segment start. */
+            std::uint64_t subscribersOffset;        /*< Offset of the maxSubscribers EventSubscriberRecords
+                                                        from the segment start. */
+            alignas(64) std::atomic<std::uint64_t> freeHead;/*< Tagged top of the free slot stack. */
+            alignas(64) std::atomic<std::uint64_t> subscriberMask;/*< Bit i is set while queue i is
+                                                                    kSubscribed. */
+        };
+
+        /**
+         * \brief Per-subscriber bookkeeping in the shared segment, used to reclaim the slots of a subscriber
+         *        whose process died.
+         * 
+         * The record is followed by a held table of maxSampleCount slot indices. The proxy enters a slot into
+         * a free entry of the table before PopBatch() advances readIndex past it, and sets the entry back to
+         * kNoEventSlot when the SamplePtr releases the slot; both are relaxed atomic stores to memory only
+         * this proxy writes. At Subscribe() the skeleton opens a pidfd for pid and watches it together with
+         * its other events. When the subscriber process exits without Unsubscribe(), the skeleton releases
+         * one reference for every slot still queued for it and for every slot in its held table that is
+         * not queued anymore (a slot that is in both was entered right before the process died and is
+         * released once), and then frees the record. SamplePtrs held by a dead process therefore never leak
+         * slots.
+         */
+        struct EventSubscriberRecord
+        {
+            std::atomic<std::int32_t> pid;          /*< Process id of the subscriber, 0 if the record is free. */
+            std::uint32_t heldCount;                /*< Entries of the held table, the subscriber's
+                                                        maxSampleCount. */
+            std::uint64_t heldOffset;               /*< Offset of the held table from the segment start. */
+        };
+
+        /**
+         * \brief Magic number at the start of an EventSegmentHeader ("ARAE").
+         * 
+         */
+        constexpr std::uint32_t kEventSegmentMagic = 0x45415241U;
+
+        /**
+         * \brief Skeleton side of an event delivered through shared memory.
+         * 
+         * The segment and its slot pool are created by the constructor, before any subscription exists, so
+         * the pool is sized from the limits given there. A subscriber can pin up to capacity slots in its
+         * queue, maxSampleCount rounded up to a power of two, plus maxSampleCount slots through its
+         * SamplePtrs. The pool thus has capacity + maxSampleCount slots for each of the maxSubscribers
+         * subscribers, plus maxAllocations slots for samples being filled or sent by the skeleton.
+         * Subscribe() rejects a larger maxSampleCount, so Allocate() can only fail when the skeleton itself
+         * holds too many unsent samples.
+         * 
+         * \tparam T    the sample type; it shall be trivially copyable and contain no pointers, since it is
+         *              accessed from several address spaces
+         */
+        template <typename T>
+        class ShmSkeletonEvent
+        {
+            /**
+             * \brief Creates the shared segment of the event.
+             * 
+             * \param[in] instance          the event instance
+             * \param[in] maxAllocations    number of samples the skeleton may hold unsent
+             * \param[in] maxSubscribers    maximum number of simultaneous subscribers, at most
+             *                              kMaxEventSubscribers
+             * \param[in] maxSampleCount    largest maxSampleCount a subscriber may pass to Subscribe()
+             */
+            ShmSkeletonEvent(ara::core::InstanceSpecifier const &instance, std::uint32_t maxAllocations, std::uint32_t maxSubscribers, std::uint32_t maxSampleCount);
+
+            /**
+             * \brief Destructor. Unlinks the segment; mapped slots stay valid for subscribers until released.
+             * 
+             */
+            ~ShmSkeletonEvent() noexcept;
+
+            /**
+             * \brief Takes a free slot from the pool.
+             * 
+             * \return ara::core::Result<SampleAllocateePtr<T>>    the slot, or kMaxSamplesExceeded if no slot
+             *                                                      is free
+             */
+            ara::core::Result<SampleAllocateePtr<T>> Allocate() noexcept;
+
+            /**
+             * \brief Publishes an allocated sample to all current subscribers.
+             * 
+             * Loads subscriberMask once; the set bits are the subscribers the sample is sent to. The
+             * reference count of the slot is set to their number plus one reference held by Send() itself.
+             * The slot index is then pushed to the queue of each of them, and finally Send() drops its own
+             * reference, which returns a slot without subscribers straight to the pool. No sample data is
+             * copied. Every push writes only cache lines of that subscriber's queue which the subscriber
+             * itself never writes, so subscribers do not contend with each other or with the publisher.
+             * If a queue is full, the sample is not queued for that subscriber: Send() releases the
+             * reference meant for it right away and droppedSamples of the queue is incremented. Every
+             * reference is thus released exactly once, either by Send() or by the subscriber.
+             * 
+             * Subscriptions change concurrently without leaking or double-freeing slots, because every
+             * pushed reference is released exactly once. A subscriber whose bit is set after the snapshot
+             * does not get the sample. A subscriber that unsubscribes after the snapshot still gets it: its
+             * queue goes from kSubscribed to kClosing and keeps its entries. Only the skeleton moves a
+             * queue from kClosing to kFree, at the start of the next Send(). It first releases the entries
+             * left in the queue, so a queue is never reused while a push to it may be in flight.
+             * 
+             * \param[in] sample    the sample to publish
+             * \return ara::core::Result<void>  void, or kNetworkBindingFailure if the segment is unusable
+             */
+            ara::core::Result<void> Send(SampleAllocateePtr<T> sample) noexcept;
+        };
+
+        /**
+         * \brief Proxy side of an event delivered through shared memory.
+         * 
+         * \tparam T    the sample type
+         */
+        template <typename T>
+        class ShmProxyEvent
+        {
+            /**
+             * \brief Maps the shared segment of the event.
+             * 
+             * \param[in] instance  the event instance
+             */
+            explicit ShmProxyEvent(ara::core::InstanceSpecifier const &instance);
+
+            /**
+             * \brief Destructor. Unsubscribes and unmaps the segment once no SamplePtr references it anymore.
+             * 
+             */
+            ~ShmProxyEvent() noexcept;
+
+            /**
+             * \brief Subscribes to the event.
+             * 
+             * \param[in] maxSampleCount    maximum number of SamplePtrs the application holds at the
+             *                              same time
+             * \return ara::core::Result<void>  void, kMaxSamplesExceeded if maxSampleCount exceeds the
+             *                                  limit the skeleton was created with, or
+             *                                  kNetworkBindingFailure if the skeleton has no subscriber
+             *                                  slot left
+             */
+            ara::core::Result<void> Subscribe(std::size_t maxSampleCount) noexcept;
+
+            /**
+             * \brief Ends the subscription. Clears the bit of the queue in subscriberMask and marks the
+             *        queue kClosing; the skeleton releases the queued samples.
+             * 
+             */
+            void Unsubscribe() noexcept;
+
+            /**
+             * \brief Returns the number of samples not delivered because the queue of this subscriber was
+             *        full.
+             * 
+             * \return std::uint64_t   the number of missed samples since Subscribe()
+             */
+            std::uint64_t GetDroppedSampleCount() const noexcept;
+
+            /**
+             * \brief Hands received samples to a callable, as SamplePtrs referencing the shared slots.
+             * 
+             * Drains the subscriber queue in one batch with SampleQueueReader::PopBatch(), limited by
+             * maxNumberOfSamples and by the SamplePtrs still available under maxSampleCount. Samples left in
+             * the queue are returned by the next call.
+             * 
+             * \tparam F    a callable with the signature void(SamplePtr<T>)
+             * \param[in] f                     the callable
+             * \param[in] maxNumberOfSamples    maximum number of samples to hand out
+             * \return ara::core::Result<std::size_t>   the number of samples handed out, or
+             *                                          kMaxSamplesExceeded if the application already
+             *                                          holds maxSampleCount SamplePtrs
+             */
+            template <typename F>
+            ara::core::Result<std::size_t> GetNewSamples(F &&f, std::size_t maxNumberOfSamples = std::numeric_limits<std::size_t>::max()) noexcept;
+        };
+    } // namespace com
+    
+} // namespace ara
+
+
+#endif // ARA_COM_SHM_EVENT_TRANSPORT_H_
@@ -0,0 +1,236 @@
+/**
+ * \file byte_order.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_COM_SOMEIP_BYTE_ORDER_H_
+#define ARA_COM_SOMEIP_BYTE_ORDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "ara/core/utility.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            /**
+             * \brief Byte order of serialized data.
+             * 
+             */
+            enum class ByteOrder : uint8_t
+            {
+                kBigEndian = 0,     /*< Network byte order, the SOME/IP default. */
+                kLittleEndian = 1,  /*< Allowed per data type by the SOME/IP transformation props. */
+            };
+
+            /**
+             * \brief Byte order of the platform.
+             * 
+             */
+            constexpr ByteOrder kHostByteOrder =
+                (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__) ? ByteOrder::kBigEndian : ByteOrder::kLittleEndian;
+
+            namespace detail
+            {
+                /**
+                 * \brief Unsigned integer type of a given size, used to swap the bytes of any scalar.
+                 * 
+                 */
+                template <std::size_t Size>
+                struct UnsignedOfSize;
+
+                template <>
+                struct UnsignedOfSize<1U>
+                {
+                    using type = std::uint8_t;
+                };
+
+                template <>
+                struct UnsignedOfSize<2U>
+                {
+                    using type = std::uint16_t;
+                };
+
+                template <>
+                struct UnsignedOfSize<4U>
+                {
+                    using type = std::uint32_t;
+                };
+
+                template <>
+                struct UnsignedOfSize<8U>
+                {
+                    using type = std::uint64_t;
+                };
+
+                inline std::uint8_t SwapBytes(std::uint8_t value) noexcept
+                {
+                    return value;
+                }
+
+                inline std::uint16_t SwapBytes(std::uint16_t value) noexcept
+                {
+                    return __builtin_bswap16(value);
+                }
+
+                inline std::uint32_t SwapBytes(std::uint32_t value) noexcept
+                {
+                    return __builtin_bswap32(value);
+                }
+
+                inline std::uint64_t SwapBytes(std::uint64_t value) noexcept
+                {
+                    return __builtin_bswap64(value);
+                }
+            } // namespace detail
+
+            /**
+             * \brief Reverses the bytes of an arithmetic or enumeration value.
+             * 
+             * Compiles to a single bswap/rev instruction for 2, 4 and 8 byte types, and to nothing for 1 byte
+             * types.
+             * 
+             * \tparam T    an arithmetic or enumeration type of 1, 2, 4 or 8 bytes
+             * \param[in] value     the value
+             * \return T    the value with its bytes reversed
+             * \note 
+             * \thread safety reentrant
+             */
+            template <typename T>
+            inline T ByteSwap(T value) noexcept
+            {
+                static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "ByteSwap requires an arithmetic or enumeration type");
+                using Bits = typename detail::UnsignedOfSize<sizeof(T)>::type;
+                Bits bits;
+                std::memcpy(&bits, &value, sizeof(T));
+                bits = detail::SwapBytes(bits);
+                std::memcpy(&value, &bits, sizeof(T));
+                return value;
+            }
+
+            /**
+             * \brief Writes one arithmetic or enumeration value to a byte buffer in the given byte order.
+             * 
+             * Order is a template argument, so the comparison with kHostByteOrder is a constant expression and
+             * the function compiles to a store, or a swap and a store. dst need not be aligned.
+             * 
+             * \tparam Order    the byte order to write
+             * \tparam T        an arithmetic or enumeration type
+             * \param[out] dst  the destination, at least sizeof(T) bytes
+             * \param[in] value the value
+             * \note 
+             * \thread safety reentrant
+             */
+            template <ByteOrder Order, typename T>
+            inline void StoreValue(ara::core::Byte *dst, T value) noexcept
+            {
+                if (Order != kHostByteOrder)
+                {
+                    value = ByteSwap(value);
+                }
+                std::memcpy(dst, &value, sizeof(T));
+            }
+
+            /**
+             * \brief Reads one arithmetic or enumeration value from a byte buffer in the given byte order.
+             * 
+             * The counterpart of StoreValue(); src need not be aligned.
+             * 
+             * \tparam Order    the byte order to read
+             * \tparam T        an arithmetic or enumeration type
+             * \param[in] src   the source, at least sizeof(T) bytes
+             * \param[out] value    the value
+             * \note 
+             * \thread safety reentrant
+             */
+            template <ByteOrder Order, typename T>
+            inline void LoadValue(ara::core::Byte const *src, T &value) noexcept
+            {
+                std::memcpy(&value, src, sizeof(T));
+                if (Order != kHostByteOrder)
+                {
+                    value = ByteSwap(value);
+                }
+            }
+
+            /**
+             * \brief Copies count values of an arithmetic type into a byte buffer in the given byte order.
+             * 
+             * If Order equals kHostByteOrder, this is a single memcpy. Otherwise it is a loop of swapped
+             * stores without dependencies between iterations, which the compiler vectorizes into byte
+             * shuffles (pshufb on x86-64, rev on AArch64). dst need not be aligned.
+             * 
+             * \tparam Order    the byte order to write
+             * \tparam T        an arithmetic or enumeration type
+             * \param[out] dst  the destination, at least count * sizeof(T) bytes
+             * \param[in] src   the values
+             * \param[in] count the number of values
+             * \note 
+             * \thread safety reentrant
+             */
+            template <ByteOrder Order, typename T>
+            inline void StoreArray(ara::core::Byte *dst, T const *src, std::size_t count) noexcept
+            {
+                if (count == 0U)
+                {
+                    return;
+                }
+                if (Order == kHostByteOrder)
+                {
+                    std::memcpy(dst, src, count * sizeof(T));
+                    return;
+                }
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    StoreValue<Order>(dst + i * sizeof(T), src[i]);
+                }
+            }
+
+            /**
+             * \brief Copies count values of an arithmetic type from a byte buffer in the given byte order.
+             * 
+             * The counterpart of StoreArray(); src need not be aligned.
+             * 
+             * \tparam Order    the byte order to read
+             * \tparam T        an arithmetic or enumeration type
+             * \param[out] dst  the values
+             * \param[in] src   the source, at least count * sizeof(T) bytes
+             * \param[in] count the number of values
+             * \note 
+             * \thread safety reentrant
+             */
+            template <ByteOrder Order, typename T>
+            inline void LoadArray(T *dst, ara::core::Byte const *src, std::size_t count) noexcept
+            {
+                if (count == 0U)
+                {
+                    return;
+                }
+                if (Order == kHostByteOrder)
+                {
+                    std::memcpy(dst, src, count * sizeof(T));
+                    return;
+                }
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    LoadValue<Order>(src + i * sizeof(T), dst[i]);
+                }
+            }
+        } // namespace someip
+        
+    } // namespace com
+    
+} // namespace ara
+
+
+#endif // ARA_COM_SOMEIP_BYTE_ORDER_H_
@@ -0,0 +1,1440 @@
+/**
+ * \file serializer.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_COM_SOMEIP_SERIALIZER_H_
+#define ARA_COM_SOMEIP_SERIALIZER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "ara/com/com_error_domain.h"
+#include "ara/com/someip/byte_order.h"
+#include "ara/core/array.h"
+#include "ara/core/map.h"
+#include "ara/core/optional.h"
+#include "ara/core/result.h"
+#include "ara/core/span.h"
+#include "ara/core/string.h"
+#include "ara/core/variant.h"
+#include "ara/core/vector.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            /**
+             * \brief Default SOME/IP transformation properties.
+             * 
+             * A set of properties is a type with the static members of this struct. It is passed as a template
+             * argument, so all decisions depending on it are taken at compile time. Length field sizes are 0,
+             * 1, 2 or 4 bytes; 0 means the length field is omitted, which is only allowed for structs and
+             * variants.
+             * 
+             */
+            struct DefaultSerializationProps
+            {
+                static constexpr ByteOrder byteOrder = ByteOrder::kBigEndian;  /*< Byte order of all values
+                                                                                    and length fields. */
+                static constexpr std::size_t arrayLengthFieldSize = 4U;         /*< For Vector and Map. */
+                static constexpr std::size_t stringLengthFieldSize = 4U;        /*< For String. */
+                static constexpr std::size_t structLengthFieldSize = 0U;        /*< For structs. */
+                static constexpr std::size_t unionLengthFieldSize = 4U;         /*< For Variant. */
+                static constexpr std::size_t unionTypeSelectorSize = 4U;        /*< For Variant. */
+            };
+
+            /**
+             * \brief Describes one member of a serializable struct.
+             * 
+             * \tparam Class    the struct
+             * \tparam Member   the type of the member
+             * \tparam Pointer  the pointer to the member
+             * \tparam DataId   the SOME/IP data id, below 4096; only used if the struct is serialized in TLV
+             *                  format, see StructTraits
+             */
+            template <typename Class, typename Member, Member Class::*Pointer, std::uint16_t DataId = 0U>
+            struct Field
+            {
+                using MemberType = Member;
+
+                static constexpr std::uint16_t kDataId = DataId;
+
+                static_assert(DataId < 4096U, "SOME/IP data ids have 12 bits");
+
+                static Member const& Get(Class const &object) noexcept
+                {
+                    return object.*Pointer;
+                }
+
+                static Member& Get(Class &object) noexcept
+                {
+                    return object.*Pointer;
+                }
+            };
+
+            /**
+             * \brief Makes a struct serializable.
+             * 
+             * Specialize it with a member type Fields, a std::tuple of Field in serialization order:
+             * 
+             *     template <> struct StructTraits<Point>
+             *     {
+             *         using Fields = std::tuple<Field<Point, float, &Point::x>,
+             *                                   Field<Point, float, &Point::y>>;
+             *     };
+             * 
+             * A struct with at least one ara::core::Optional member is serialized in TLV format: every
+             * member is preceded by a tag holding its wire type and DataId, empty optionals are omitted,
+             * and members with unknown data ids are skipped on deserialization. Such a struct requires a
+             * struct length field. Optional is only supported as a struct member.
+             * 
+             * \tparam T    the struct
+             */
+            template <typename T>
+            struct StructTraits
+            {
+            };
+
+            /**
+             * \brief Compile-time (de)serializer of a type.
+             * 
+             * Specializations exist for arithmetic and enumeration types, bool, ara::core::Array, Vector,
+             * String, Map and Variant, and for every type with a StructTraits specialization; they are
+             * composed recursively, so the complete serializer of a data type is instantiated at compile time
+             * and contains no virtual calls. Every specialization provides
+             * - kIsFixedSize, and kFixedSize for fixed-size types,
+             * - kLengthFieldSize, the size of the length field the serialization starts with, 0 if none,
+             * - GetSize(value), the number of bytes Write() produces,
+             * - Write(value, out), which writes to out without bounds checks and returns the end of the
+             *   written data, or nullptr if a length exceeds its length field,
+             * - Read(in, end, value), which reads from [in, end), advances in and returns false if the data
+             *   is truncated or malformed,
+             * - for fixed-size types ReadFixed(in, value), which reads kFixedSize bytes without bounds checks.
+             * 
+             * GetSize() and Write() never allocate and are noexcept. Read() of Vector, String, Map and Variant,
+             * and of every type containing them, allocates and is not noexcept: std::bad_alloc propagates to
+             * the caller. Read() of fixed-size types does not allocate and is noexcept.
+             * 
+             * Vectors and arrays of arithmetic types are converted with StoreArray() and LoadArray() in one
+             * pass. Strings are serialized as UTF-8 with byte order mark and terminating zero, and variants
+             * with a type selector holding the one-based alternative index.
+             * 
+             * \tparam T        the type
+             * \tparam Props    the transformation properties
+             */
+            template <typename T, typename Props = DefaultSerializationProps, typename Enable = void>
+            struct Serializer;
+
+            namespace detail
+            {
+                /**
+                 * \brief true for the types which are copied with StoreArray() and LoadArray().
+                 * 
+                 */
+                template <typename T>
+                struct IsScalar : std::integral_constant<bool, (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value) || std::is_enum<T>::value>
+                {
+                };
+
+                template <typename... Ts>
+                struct MakeVoid
+                {
+                    using type = void;
+                };
+
+                template <typename... Ts>
+                using VoidT = typename MakeVoid<Ts...>::type;
+
+                /**
+                 * \brief true if StructTraits is specialized for T.
+                 * 
+                 */
+                template <typename T, typename = void>
+                struct HasStructTraits : std::false_type
+                {
+                };
+
+                template <typename T>
+                struct HasStructTraits<T, VoidT<typename StructTraits<T>::Fields>> : std::true_type
+                {
+                };
+
+                template <typename T>
+                struct IsOptional : std::false_type
+                {
+                };
+
+                template <typename T>
+                struct IsOptional<ara::core::Optional<T>> : std::true_type
+                {
+                };
+
+                constexpr std::size_t SumFirst(std::size_t count, std::initializer_list<std::size_t> values) noexcept
+                {
+                    std::size_t sum = 0U;
+                    std::size_t index = 0U;
+                    for (std::size_t value : values)
+                    {
+                        if (index < count)
+                        {
+                            sum += value;
+                        }
+                        ++index;
+                    }
+                    return sum;
+                }
+
+                constexpr bool AllOf(std::initializer_list<bool> values) noexcept
+                {
+                    for (bool value : values)
+                    {
+                        if (!value)
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                constexpr bool AnyOf(std::initializer_list<bool> values) noexcept
+                {
+                    for (bool value : values)
+                    {
+                        if (value)
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                /**
+                 * \brief Reads and writes a length field or type selector of Size bytes.
+                 * 
+                 */
+                template <ByteOrder Order, std::size_t Size>
+                struct LengthField;
+
+                template <ByteOrder Order>
+                struct LengthField<Order, 0U>
+                {
+                    static constexpr std::size_t kSize = 0U;
+                    static constexpr std::uint64_t kMax = std::numeric_limits<std::uint32_t>::max();
+
+                    static void Store(ara::core::Byte *, std::uint64_t) noexcept
+                    {
+                    }
+
+                    static std::uint32_t Load(ara::core::Byte const *) noexcept
+                    {
+                        return std::numeric_limits<std::uint32_t>::max();
+                    }
+                };
+
+                template <ByteOrder Order>
+                struct LengthField<Order, 1U>
+                {
+                    static constexpr std::size_t kSize = 1U;
+                    static constexpr std::uint64_t kMax = std::numeric_limits<std::uint8_t>::max();
+
+                    static void Store(ara::core::Byte *dst, std::uint64_t length) noexcept
+                    {
+                        StoreValue<Order>(dst, static_cast<std::uint8_t>(length));
+                    }
+
+                    static std::uint32_t Load(ara::core::Byte const *src) noexcept
+                    {
+                        std::uint8_t length;
+                        LoadValue<Order>(src, length);
+                        return length;
+                    }
+                };
+
+                template <ByteOrder Order>
+                struct LengthField<Order, 2U>
+                {
+                    static constexpr std::size_t kSize = 2U;
+                    static constexpr std::uint64_t kMax = std::numeric_limits<std::uint16_t>::max();
+
+                    static void Store(ara::core::Byte *dst, std::uint64_t length) noexcept
+                    {
+                        StoreValue<Order>(dst, static_cast<std::uint16_t>(length));
+                    }
+
+                    static std::uint32_t Load(ara::core::Byte const *src) noexcept
+                    {
+                        std::uint16_t length;
+                        LoadValue<Order>(src, length);
+                        return length;
+                    }
+                };
+
+                template <ByteOrder Order>
+                struct LengthField<Order, 4U>
+                {
+                    static constexpr std::size_t kSize = 4U;
+                    static constexpr std::uint64_t kMax = std::numeric_limits<std::uint32_t>::max();
+
+                    static void Store(ara::core::Byte *dst, std::uint64_t length) noexcept
+                    {
+                        StoreValue<Order>(dst, static_cast<std::uint32_t>(length));
+                    }
+
+                    static std::uint32_t Load(ara::core::Byte const *src) noexcept
+                    {
+                        std::uint32_t length;
+                        LoadValue<Order>(src, length);
+                        return length;
+                    }
+                };
+
+                inline std::size_t Remaining(ara::core::Byte const *in, ara::core::Byte const *end) noexcept
+                {
+                    return static_cast<std::size_t>(end - in);
+                }
+
+                /**
+                 * \brief Read() of fixed-size types: one bounds check, then ReadFixed().
+                 * 
+                 */
+                template <typename S, typename T>
+                inline bool ReadFixedChecked(ara::core::Byte const *&in, ara::core::Byte const *end, T &value) noexcept
+                {
+                    if (Remaining(in, end) < S::kFixedSize)
+                    {
+                        return false;
+                    }
+                    S::ReadFixed(in, value);
+                    in += S::kFixedSize;
+                    return true;
+                }
+
+                /**
+                 * \brief Reads a length field and narrows [in, end) to the data it covers.
+                 * 
+                 */
+                template <typename Length>
+                inline bool ReadLength(ara::core::Byte const *&in, ara::core::Byte const *end, ara::core::Byte const *&stop) noexcept
+                {
+                    if (Remaining(in, end) < Length::kSize)
+                    {
+                        return false;
+                    }
+                    std::uint32_t const length = Length::Load(in);
+                    in += Length::kSize;
+                    if (Remaining(in, end) < length)
+                    {
+                        return false;
+                    }
+                    stop = in + length;
+                    return true;
+                }
+
+                /**
+                 * \brief Total serialized size of count elements.
+                 * 
+                 */
+                template <typename Element, typename C>
+                inline std::size_t ElementsSize(C const &, std::size_t count, std::true_type /* fixed size */) noexcept
+                {
+                    return count * Element::kFixedSize;
+                }
+
+                template <typename Element, typename C>
+                inline std::size_t ElementsSize(C const &values, std::size_t count, std::false_type /* fixed size */) noexcept
+                {
+                    std::size_t size = 0U;
+                    for (std::size_t i = 0U; i < count; ++i)
+                    {
+                        size += Element::GetSize(values[i]);
+                    }
+                    return size;
+                }
+
+                /**
+                 * \brief Writes count elements, in one StoreArray() for scalars.
+                 * 
+                 */
+                template <typename Props, typename T, typename C>
+                inline ara::core::Byte* WriteElements(C const &values, std::size_t count, ara::core::Byte *out, std::true_type /* scalar */) noexcept
+                {
+                    StoreArray<Props::byteOrder>(out, values.data(), count);
+                    return out + count * sizeof(T);
+                }
+
+                template <typename Props, typename T, typename C>
+                inline ara::core::Byte* WriteElements(C const &values, std::size_t count, ara::core::Byte *out, std::false_type /* scalar */) noexcept
+                {
+                    for (std::size_t i = 0U; (i < count) && (out != nullptr); ++i)
+                    {
+                        out = Serializer<T, Props>::Write(values[i], out);
+                    }
+                    return out;
+                }
+
+                /**
+                 * \brief Reads count fixed-size elements without bounds checks, in one LoadArray() for scalars.
+                 * 
+                 */
+                template <typename Props, typename T, typename C>
+                inline void ReadFixedElements(ara::core::Byte const *in, C &values, std::size_t count, std::true_type /* scalar */) noexcept
+                {
+                    LoadArray<Props::byteOrder>(values.data(), in, count);
+                }
+
+                template <typename Props, typename T, typename C>
+                inline void ReadFixedElements(ara::core::Byte const *in, C &values, std::size_t count, std::false_type /* scalar */) noexcept
+                {
+                    for (std::size_t i = 0U; i < count; ++i)
+                    {
+                        T element;
+                        Serializer<T, Props>::ReadFixed(in + i * Serializer<T, Props>::kFixedSize, element);
+                        values[i] = std::move(element);
+                    }
+                }
+            } // namespace detail
+
+            /**
+             * \brief Serializer of arithmetic types other than bool, and of enumerations.
+             * 
+             */
+            template <typename T, typename Props>
+            struct Serializer<T, Props, typename std::enable_if<detail::IsScalar<T>::value>::type>
+            {
+                static constexpr bool kIsFixedSize = true;
+                static constexpr std::size_t kFixedSize = sizeof(T);
+                static constexpr std::size_t kLengthFieldSize = 0U;
+
+                static std::size_t GetSize(T const &) noexcept
+                {
+                    return kFixedSize;
+                }
+
+                static ara::core::Byte* Write(T const &value, ara::core::Byte *out) noexcept
+                {
+                    StoreValue<Props::byteOrder>(out, value);
+                    return out + kFixedSize;
+                }
+
+                static void ReadFixed(ara::core::Byte const *in, T &value) noexcept
+                {
+                    LoadValue<Props::byteOrder>(in, value);
+                }
+
+                static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, T &value) noexcept
+                {
+                    return detail::ReadFixedChecked<Serializer>(in, end, value);
+                }
+            };
+
+            /**
+             * \brief Serializer of bool, one byte holding 0 or 1; any non-zero byte reads as true.
+             * 
+             */
+            template <typename Props>
+            struct Serializer<bool, Props>
+            {
+                static constexpr bool kIsFixedSize = true;
+                static constexpr std::size_t kFixedSize = 1U;
+                static constexpr std::size_t kLengthFieldSize = 0U;
+
+                static std::size_t GetSize(bool const &) noexcept
+                {
+                    return kFixedSize;
+                }
+
+                static ara::core::Byte* Write(bool const &value, ara::core::Byte *out) noexcept
+                {
+                    std::uint8_t const byte = value ? 1U : 0U;
+                    std::memcpy(out, &byte, 1U);
+                    return out + kFixedSize;
+                }
+
+                static void ReadFixed(ara::core::Byte const *in, bool &value) noexcept
+                {
+                    std::uint8_t byte;
+                    std::memcpy(&byte, in, 1U);
+                    value = (byte != 0U);
+                }
+
+                static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, bool &value) noexcept
+                {
+                    return detail::ReadFixedChecked<Serializer>(in, end, value);
+                }
+            };
+
+            /**
+             * \brief Serializer of fixed-length arrays of fixed-size elements: no length field, fixed size.
+             * 
+             */
+            template <typename T, std::size_t N, typename Props>
+            struct Serializer<ara::core::Array<T, N>, Props, typename std::enable_if<Serializer<T, Props>::kIsFixedSize>::type>
+            {
+                using Element = Serializer<T, Props>;
+
+                static constexpr bool kIsFixedSize = true;
+                static constexpr std::size_t kFixedSize = N * Element::kFixedSize;
+                static constexpr std::size_t kLengthFieldSize = 0U;
+
+                static std::size_t GetSize(ara::core::Array<T, N> const &) noexcept
+                {
+                    return kFixedSize;
+                }
+
+                static ara::core::Byte* Write(ara::core::Array<T, N> const &value, ara::core::Byte *out) noexcept
+                {
+                    return detail::WriteElements<Props, T>(value, N, out, detail::IsScalar<T>());
+                }
+
+                static void ReadFixed(ara::core::Byte const *in, ara::core::Array<T, N> &value) noexcept
+                {
+                    detail::ReadFixedElements<Props, T>(in, value, N, detail::IsScalar<T>());
+                }
+
+                static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, ara::core::Array<T, N> &value) noexcept
+                {
+                    return detail::ReadFixedChecked<Serializer>(in, end, value);
+                }
+            };
+
+            /**
+             * \brief Serializer of fixed-length arrays of variable-size elements: no length field.
+             * 
+             */
+            template <typename T, std::size_t N, typename Props>
+            struct Serializer<ara::core::Array<T, N>, Props, typename std::enable_if<!Serializer<T, Props>::kIsFixedSize>::type>
+            {
+                using Element = Serializer<T, Props>;
+
+                static constexpr bool kIsFixedSize = false;
+                static constexpr std::size_t kLengthFieldSize = 0U;
+
+                static std::size_t GetSize(ara::core::Array<T, N> const &value) noexcept
+                {
+                    return detail::ElementsSize<Element>(value, N, std::false_type());
+                }
+
+                static ara::core::Byte* Write(ara::core::Array<T, N> const &value, ara::core::Byte *out) noexcept
+                {
+                    return detail::WriteElements<Props, T>(value, N, out, std::false_type());
+                }
+
+                static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, ara::core::Array<T, N> &value)
+                {
+                    for (std::size_t i = 0U; i < N; ++i)
+                    {
+                        if (!Element::Read(in, end, value[i]))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            };
+
+            /**
+             * \brief Serializer of dynamic-length arrays: a length field in bytes, then the elements.
+             * 
+             * \note Deserialization resizes the vector and therefore allocates; std::bad_alloc propagates.
+             */
+            template <typename T, typename Allocator, typename Props>
+            struct Serializer<ara::core::Vector<T, Allocator>, Props>
+            {
+                using Value = ara::core::Vector<T, Allocator>;
+                using Element = Serializer<T, Props>;
+                using Length = detail::LengthField<Props::byteOrder, Props::arrayLengthFieldSize>;
+                using ElementIsFixed = std::integral_constant<bool, Element::kIsFixedSize>;
+
+                static_assert(Props::arrayLengthFieldSize != 0U, "dynamic-length arrays require a length field");
+
+                static constexpr bool kIsFixedSize = false;
+                static constexpr std::size_t kLengthFieldSize = Length::kSize;
+
+                static std::size_t GetSize(Value const &value) noexcept
+                {
+                    return Length::kSize + detail::ElementsSize<Element>(value, value.size(), ElementIsFixed());
+                }
+
+                static ara::core::Byte* Write(Value const &value, ara::core::Byte *out) noexcept
+                {
+                    ara::core::Byte *const begin = out + Length::kSize;
+                    ara::core::Byte *const end = detail::WriteElements<Props, T>(value, value.size(), begin, detail::IsScalar<T>());
+                    if ((end == nullptr) || (static_cast<std::uint64_t>(end - begin) > Length::kMax))
+                    {
+                        return nullptr;
+                    }
+                    Length::Store(out, static_cast<std::uint64_t>(end - begin));
+                    return end;
+                }
+
+                static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, Value &value)
+                {
+                    ara::core::Byte const *stop;
+                    if (!detail::ReadLength<Length>(in, end, stop))
+                    {
+                        return false;
+                    }
+                    if (!ReadElements(in, stop, value, ElementIsFixed()))
+                    {
+                        return false;
+                    }
+                    in = stop;
+                    return true;
+                }
+
+                static bool ReadElements(ara::core::Byte const *in, ara::core::Byte const *stop, Value &value, std::true_type /* fixed size */)
+                {
+                    static_assert(Element::kFixedSize != 0U, "elements of dynamic-length arrays shall not be empty");
+                    std::size_t const length = detail::Remaining(in, stop);
+                    if ((length % Element::kFixedSize) != 0U)
+                    {
+                        return false;
+                    }
+                    value.resize(length / Element::kFixedSize);
+                    detail::ReadFixedElements<Props, T>(in, value, value.size(), detail::IsScalar<T>());
+                    return true;
+                }
+
+                static bool ReadElements(ara::core::Byte const *in, ara::core::Byte const *stop, Value &value, std::false_type /* fixed size */)
+                {
+                    value.clear();
+                    while (in != stop)
+                    {
+                        T element;
+                        if (!Element::Read(in, stop, element))
+                        {
+                            return false;
+                        }
+                        value.push_back(std::move(element));
+                    }
+                    return true;
+                }
+            };
+
+            /**
+             * \brief Serializer of strings: a length field in bytes, the UTF-8 byte order mark, the characters
+             *        and a terminating zero.
+             * 
+             */
+            template <typename Props>
+            struct Serializer<ara::core::String, Props>
+            {
+                using Length = detail::LengthField<Props::byteOrder, Props::stringLengthFieldSize>;
+
+                static_assert(Props::stringLengthFieldSize != 0U, "strings require a length field");
+
+                static constexpr bool kIsFixedSize = false;
+                static constexpr std::size_t kLengthFieldSize = Length::kSize;
+                static constexpr std::size_t kBomSize = 3U;
+
+                static std::uint8_t const* Bom() noexcept
+                {
+                    static std::uint8_t const kBom[kBomSize] = {0xEFU, 0xBBU, 0xBFU};
+                    return kBom;
+                }
+
+                static std::size_t GetSize(ara::core::String const &value) noexcept
+                {
+                    return Length::kSize + kBomSize + value.size() + 1U;
+                }
+
+                static ara::core::Byte* Write(ara::core::String const &value, ara::core::Byte *out) noexcept
+                {
+                    std::uint64_t const length = kBomSize + value.size() + 1U;
+                    if (length > Length::kMax)
+                    {
+                        return nullptr;
+                    }
+                    Length::Store(out, length);
+                    out += Length::kSize;
+                    std::memcpy(out, Bom(), kBomSize);
+                    out += kBomSize;
+                    std::memcpy(out, value.data(), value.size());
+                    out += value.size();
+                    std::uint8_t const terminator = 0U;
+                    std::memcpy(out, &terminator, 1U);
+                    return out + 1U;
+                }
+
+                static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, ara::core::String &value)
+                {
+                    ara::core::Byte const *stop;
+                    if (!detail::ReadLength<Length>(in, end, stop))
+                    {
+                        return false;
+                    }
+                    std::size_t const length = detail::Remaining(in, stop);
+                    std::uint8_t terminator = 1U;
+                    if (length >= (kBomSize + 1U))
+                    {
+                        std::memcpy(&terminator, stop - 1, 1U);
+                    }
+                    if ((terminator != 0U) || (std::memcmp(in, Bom(), kBomSize) != 0))
+                    {
+                        return false;
+                    }
+                    value.assign(reinterpret_cast<char const*>(in + kBomSize), length - kBomSize - 1U);
+                    in = stop;
+                    return true;
+                }
+            };
+
+            /**
+             * \brief Serializer of maps: a length field in bytes, then key and value of every entry.
+             * 
+             * \note Deserialization fails on duplicate keys.
+             */
+            template <typename K, typename V, typename Compare, typename Allocator, typename Props>
+            struct Serializer<ara::core::Map<K, V, Compare, Allocator>, Props>
+            {
+                using Value = ara::core::Map<K, V, Compare, Allocator>;
+                using Length = detail::LengthField<Props::byteOrder, Props::arrayLengthFieldSize>;
+
+                static_assert(Props::arrayLengthFieldSize != 0U, "maps require a length field");
+
+                static constexpr bool kIsFixedSize = false;
+                static constexpr std::size_t kLengthFieldSize = Length::kSize;
+
+                static std::size_t GetSize(Value const &value) noexcept
+                {
+                    std::size_t size = Length::kSize;
+                    for (auto const &entry : value)
+                    {
+                        size += Serializer<K, Props>::GetSize(entry.first) + Serializer<V, Props>::GetSize(entry.second);
+                    }
+                    return size;
+                }
+
+                static ara::core::Byte* Write(Value const &value, ara::core::Byte *out) noexcept
+                {
+                    ara::core::Byte *const begin = out + Length::kSize;
+                    ara::core::Byte *cursor = begin;
+                    for (auto const &entry : value)
+                    {
+                        cursor = Serializer<K, Props>::Write(entry.first, cursor);
+                        if (cursor == nullptr)
+                        {
+                            return nullptr;
+                        }
+                        cursor = Serializer<V, Props>::Write(entry.second, cursor);
+                        if (cursor == nullptr)
+                        {
+                            return nullptr;
+                        }
+                    }
+                    if (static_cast<std::uint64_t>(cursor - begin) > Length::kMax)
+                    {
+                        return nullptr;
+                    }
+                    Length::Store(out, static_cast<std::uint64_t>(cursor - begin));
+                    return cursor;
+                }
+
+                static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, Value &value)
+                {
+                    ara::core::Byte const *stop;
+                    if (!detail::ReadLength<Length>(in, end, stop))
+                    {
+                        return false;
+                    }
+                    value.clear();
+                    while (in != stop)
+                    {
+                        K key;
+                        V mapped;
+                        if (!Serializer<K, Props>::Read(in, stop, key) || !Serializer<V, Props>::Read(in, stop, mapped))
+                        {
+                            return false;
+                        }
+                        if (!value.emplace(std::move(key), std::move(mapped)).second)
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            };
+
+            namespace detail
+            {
+                /**
+                 * \brief Dispatch tables of a variant, one function per alternative, built at compile time.
+                 * 
+                 */
+                template <typename Props, typename Value, typename Indices>
+                struct VariantTable;
+
+                template <typename Props, typename... Ts, std::size_t... Is>
+                struct VariantTable<Props, ara::core::Variant<Ts...>, std::index_sequence<Is...>>
+                {
+                    using Value = ara::core::Variant<Ts...>;
+
+                    template <std::size_t I>
+                    using Alternative = typename std::tuple_element<I, std::tuple<Ts...>>::type;
+
+                    template <std::size_t I>
+                    static std::size_t SizeOf(Value const &value) noexcept
+                    {
+                        return Serializer<Alternative<I>, Props>::GetSize(ara::core::get<I>(value));
+                    }
+
+                    template <std::size_t I>
+                    static ara::core::Byte* WriteOf(Value const &value, ara::core::Byte *out) noexcept
+                    {
+                        return Serializer<Alternative<I>, Props>::Write(ara::core::get<I>(value), out);
+                    }
+
+                    template <std::size_t I>
+                    static bool ReadOf(ara::core::Byte const *&in, ara::core::Byte const *end, Value &value)
+                    {
+                        Alternative<I> element;
+                        if (!Serializer<Alternative<I>, Props>::Read(in, end, element))
+                        {
+                            return false;
+                        }
+                        value.template emplace<I>(std::move(element));
+                        return true;
+                    }
+
+                    static std::size_t Size(std::size_t index, Value const &value) noexcept
+                    {
+                        using Function = std::size_t (*)(Value const &);
+                        static constexpr Function kTable[] = {&SizeOf<Is>...};
+                        return kTable[index](value);
+                    }
+
+                    static ara::core::Byte* Write(std::size_t index, Value const &value, ara::core::Byte *out) noexcept
+                    {
+                        using Function = ara::core::Byte* (*)(Value const &, ara::core::Byte *);
+                        static constexpr Function kTable[] = {&WriteOf<Is>...};
+                        return kTable[index](value, out);
+                    }
+
+                    static bool Read(std::size_t index, ara::core::Byte const *&in, ara::core::Byte const *end, Value &value)
+                    {
+                        using Function = bool (*)(ara::core::Byte const *&, ara::core::Byte const *, Value &);
+                        static constexpr Function kTable[] = {&ReadOf<Is>...};
+                        return kTable[index](in, end, value);
+                    }
+                };
+            } // namespace detail
+
+            /**
+             * \brief Serializer of variants: a length field, a type selector holding the one-based index of
+             *        the alternative, and the alternative.
+             * 
+             * The alternative is selected through a table of functions built at compile time, not through a
+             * chain of comparisons. With a length field, data behind the alternative is skipped.
+             */
+            template <typename Props, typename... Ts>
+            struct Serializer<ara::core::Variant<Ts...>, Props>
+            {
+                using Value = ara::core::Variant<Ts...>;
+                using Length = detail::LengthField<Props::byteOrder, Props::unionLengthFieldSize>;
+                using Selector = detail::LengthField<Props::byteOrder, Props::unionTypeSelectorSize>;
+                using Table = detail::VariantTable<Props, Value, std::index_sequence_for<Ts...>>;
+
+                static_assert(Props::unionTypeSelectorSize != 0U, "variants require a type selector");
+
+                static constexpr bool kIsFixedSize = false;
+                static constexpr std::size_t kLengthFieldSize = 0U;  /*< The union length field does not cover
+                                                                         the type selector. */
+
+                static std::size_t GetSize(Value const &value) noexcept
+                {
+                    return Length::kSize + Selector::kSize + Table::Size(value.index(), value);
+                }
+
+                static ara::core::Byte* Write(Value const &value, ara::core::Byte *out) noexcept
+                {
+                    std::size_t const index = value.index();
+                    if (index >= sizeof...(Ts))
+                    {
+                        return nullptr;
+                    }
+                    ara::core::Byte *const begin = out + Length::kSize + Selector::kSize;
+                    ara::core::Byte *const end = Table::Write(index, value, begin);
+                    if ((end == nullptr) || (static_cast<std::uint64_t>(end - begin) > Length::kMax))
+                    {
+                        return nullptr;
+                    }
+                    Length::Store(out, static_cast<std::uint64_t>(end - begin));
+                    Selector::Store(out + Length::kSize, index + 1U);
+                    return end;
+                }
+
+                static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, Value &value)
+                {
+                    if (detail::Remaining(in, end) < (Length::kSize + Selector::kSize))
+                    {
+                        return false;
+                    }
+                    std::uint32_t const length = Length::Load(in);
+                    std::uint32_t const selector = Selector::Load(in + Length::kSize);
+                    in += Length::kSize + Selector::kSize;
+                    ara::core::Byte const *stop = end;
+                    if (Length::kSize != 0U)
+                    {
+                        if (detail::Remaining(in, end) < length)
+                        {
+                            return false;
+                        }
+                        stop = in + length;
+                    }
+                    if ((selector == 0U) || (selector > sizeof...(Ts)) || !Table::Read(selector - 1U, in, stop, value))
+                    {
+                        return false;
+                    }
+                    if (Length::kSize != 0U)
+                    {
+                        in = stop;
+                    }
+                    return true;
+                }
+            };
+
+            namespace detail
+            {
+                /**
+                 * \brief Serialized size of a fixed-size type, 0 for other types.
+                 * 
+                 */
+                template <typename S, typename = void>
+                struct FixedSizeOf : std::integral_constant<std::size_t, 0U>
+                {
+                };
+
+                template <typename S>
+                struct FixedSizeOf<S, typename std::enable_if<S::kIsFixedSize>::type> : std::integral_constant<std::size_t, S::kFixedSize>
+                {
+                };
+
+                /**
+                 * \brief Serializer of a struct whose members are written back-to-back, optionally preceded
+                 *        by a struct length field.
+                 * 
+                 * Without length field and with fixed-size members only, the struct is fixed-size: Write()
+                 * and ReadFixed() store and load every member at an offset computed at compile time, with no
+                 * loop, branch or bounds check, and Read() performs a single bounds check. Adjacent scalar
+                 * stores at constant offsets are merged by the compiler.
+                 */
+                template <typename Props, typename T, typename Fields, typename Indices>
+                struct SequentialStruct;
+
+                template <typename Props, typename T, typename... Fs, std::size_t... Is>
+                struct SequentialStruct<Props, T, std::tuple<Fs...>, std::index_sequence<Is...>>
+                {
+                    template <typename F>
+                    using Member = Serializer<typename F::MemberType, Props>;
+
+                    using Length = LengthField<Props::byteOrder, Props::structLengthFieldSize>;
+
+                    static constexpr bool kIsFixedSize = AllOf({Member<Fs>::kIsFixedSize...}) && (Length::kSize == 0U);
+
+                    static constexpr std::size_t kFixedSize = SumFirst(sizeof...(Fs), {FixedSizeOf<Member<Fs>>::value...});
+
+                    static constexpr std::size_t kLengthFieldSize = Length::kSize;
+
+                    template <std::size_t I>
+                    static constexpr std::size_t OffsetOf() noexcept
+                    {
+                        return SumFirst(I, {FixedSizeOf<Member<Fs>>::value...});
+                    }
+
+                    static std::size_t GetSize(T const &value) noexcept
+                    {
+                        return Length::kSize + SumFirst(sizeof...(Fs), {Member<Fs>::GetSize(Fs::Get(value))...});
+                    }
+
+                    static ara::core::Byte* Write(T const &value, ara::core::Byte *out) noexcept
+                    {
+                        return Write(value, out, std::integral_constant<bool, kIsFixedSize>());
+                    }
+
+                    static ara::core::Byte* Write(T const &value, ara::core::Byte *out, std::true_type /* fixed size */) noexcept
+                    {
+                        int const expand[] = {0, (Member<Fs>::Write(Fs::Get(value), out + OffsetOf<Is>()), 0)...};
+                        static_cast<void>(expand);
+                        return out + kFixedSize;
+                    }
+
+                    static ara::core::Byte* Write(T const &value, ara::core::Byte *out, std::false_type /* fixed size */) noexcept
+                    {
+                        ara::core::Byte *const begin = out + Length::kSize;
+                        ara::core::Byte *cursor = begin;
+                        int const expand[] = {0, ((cursor = (cursor == nullptr) ? nullptr : Member<Fs>::Write(Fs::Get(value), cursor)), 0)...};
+                        static_cast<void>(expand);
+                        if ((cursor == nullptr) || (static_cast<std::uint64_t>(cursor - begin) > Length::kMax))
+                        {
+                            return nullptr;
+                        }
+                        Length::Store(out, static_cast<std::uint64_t>(cursor - begin));
+                        return cursor;
+                    }
+
+                    static void ReadFixed(ara::core::Byte const *in, T &value) noexcept
+                    {
+                        int const expand[] = {0, (Member<Fs>::ReadFixed(in + OffsetOf<Is>(), Fs::Get(value)), 0)...};
+                        static_cast<void>(expand);
+                    }
+
+                    static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, T &value) noexcept(kIsFixedSize)
+                    {
+                        return Read(in, end, value, std::integral_constant<bool, kIsFixedSize>());
+                    }
+
+                    static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, T &value, std::true_type /* fixed size */) noexcept
+                    {
+                        return ReadFixedChecked<SequentialStruct>(in, end, value);
+                    }
+
+                    static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, T &value, std::false_type /* fixed size */)
+                    {
+                        ara::core::Byte const *stop = end;
+                        if ((Length::kSize != 0U) && !ReadLength<Length>(in, end, stop))
+                        {
+                            return false;
+                        }
+                        bool ok = true;
+                        int const expand[] = {0, ((ok = ok && Member<Fs>::Read(in, stop, Fs::Get(value))), 0)...};
+                        static_cast<void>(expand);
+                        if (ok && (Length::kSize != 0U))
+                        {
+                            in = stop;
+                        }
+                        return ok;
+                    }
+                };
+
+                /**
+                 * \brief Wire type of a member in a SOME/IP TLV tag.
+                 * 
+                 * Scalars of 1, 2, 4 and 8 bytes use wire types 0 to 3. Members starting with their own length
+                 * field of 1, 2 or 4 bytes use wire types 5, 6 and 7, which announce a length field of that
+                 * size: the member's own length field serves as the TLV length. Members without length field
+                 * use wire type 7 and are preceded by an additional 4 byte length field.
+                 */
+                template <typename M, typename Props>
+                struct TlvWireType : std::integral_constant<std::uint16_t,
+                    (IsScalar<M>::value || std::is_same<M, bool>::value) ?
+                        (sizeof(M) == 1U ? 0U : sizeof(M) == 2U ? 1U : sizeof(M) == 4U ? 2U : 3U) :
+                    Serializer<M, Props>::kLengthFieldSize == 1U ? 5U :
+                    Serializer<M, Props>::kLengthFieldSize == 2U ? 6U : 7U>
+                {
+                    static_assert(!(IsScalar<M>::value || std::is_same<M, bool>::value) || (sizeof(M) == 1U) ||
+                        (sizeof(M) == 2U) || (sizeof(M) == 4U) || (sizeof(M) == 8U), "TLV scalars have 1, 2, 4 or 8 bytes");
+                };
+
+                /**
+                 * \brief Size of the length field a TLV member is preceded by in addition to its own
+                 *        serialization: 4 for members with wire type 7 but no own length field, 0 otherwise.
+                 * 
+                 */
+                template <typename M, typename Props>
+                struct TlvExtraLengthSize : std::integral_constant<std::size_t,
+                    ((TlvWireType<M, Props>::value >= 4U) && (Serializer<M, Props>::kLengthFieldSize == 0U)) ? 4U : 0U>
+                {
+                };
+
+                template <typename M>
+                struct TlvValueType
+                {
+                    using type = M;
+                };
+
+                template <typename M>
+                struct TlvValueType<ara::core::Optional<M>>
+                {
+                    using type = M;
+                };
+
+                /**
+                 * \brief Serializer of a struct in TLV format.
+                 * 
+                 * Every present member is written as a 16 bit tag (wire type in bits 12 to 14, data id in bits
+                 * 0 to 11) followed by the member, see TlvWireType. Members with their own length field are
+                 * written unchanged, so no length is stored twice; only members without length field, such as
+                 * fixed-length arrays, variants and structs without struct length field, get an additional
+                 * 4 byte length. On deserialization, members are matched by data id in any order, and a known
+                 * member shall carry the wire type it is written with. Unknown members are skipped; for these,
+                 * wire type 4 is taken to announce a length field of Props::arrayLengthFieldSize bytes. A
+                 * missing member that is not optional fails the deserialization; optionals that are not
+                 * present are reset.
+                 */
+                template <typename Props, typename T, typename Fields, typename Indices>
+                struct TlvStruct;
+
+                template <typename Props, typename T, typename... Fs, std::size_t... Is>
+                struct TlvStruct<Props, T, std::tuple<Fs...>, std::index_sequence<Is...>>
+                {
+                    using Length = LengthField<Props::byteOrder, Props::structLengthFieldSize>;
+                    using Tag = LengthField<Props::byteOrder, 2U>;
+                    using TlvLength = LengthField<Props::byteOrder, 4U>;
+
+                    static_assert(Props::structLengthFieldSize != 0U, "structs in TLV format require a struct length field");
+                    static_assert(sizeof...(Fs) <= 64U, "structs in TLV format support up to 64 members");
+
+                    static constexpr bool kIsFixedSize = false;
+                    static constexpr std::size_t kLengthFieldSize = Length::kSize;
+
+                    template <typename F>
+                    using ValueType = typename TlvValueType<typename F::MemberType>::type;
+
+                    template <typename M>
+                    static bool IsPresent(M const &) noexcept
+                    {
+                        return true;
+                    }
+
+                    template <typename M>
+                    static bool IsPresent(ara::core::Optional<M> const &member) noexcept
+                    {
+                        return member.has_value();
+                    }
+
+                    template <typename M>
+                    static M const& ValueOf(M const &member) noexcept
+                    {
+                        return member;
+                    }
+
+                    template <typename M>
+                    static M const& ValueOf(ara::core::Optional<M> const &member) noexcept
+                    {
+                        return *member;
+                    }
+
+                    template <typename F>
+                    static std::size_t MemberSize(T const &value) noexcept
+                    {
+                        if (!IsPresent(F::Get(value)))
+                        {
+                            return 0U;
+                        }
+                        return Tag::kSize + TlvExtraLengthSize<ValueType<F>, Props>::value + Serializer<ValueType<F>, Props>::GetSize(ValueOf(F::Get(value)));
+                    }
+
+                    template <typename F>
+                    static ara::core::Byte* WriteMember(T const &value, ara::core::Byte *out) noexcept
+                    {
+                        if ((out == nullptr) || !IsPresent(F::Get(value)))
+                        {
+                            return out;
+                        }
+                        std::uint16_t const wireType = TlvWireType<ValueType<F>, Props>::value;
+                        Tag::Store(out, static_cast<std::uint16_t>((wireType << 12U) | F::kDataId));
+                        out += Tag::kSize;
+                        if (TlvExtraLengthSize<ValueType<F>, Props>::value == 0U)
+                        {
+                            return Serializer<ValueType<F>, Props>::Write(ValueOf(F::Get(value)), out);
+                        }
+                        ara::core::Byte *const begin = out + TlvLength::kSize;
+                        ara::core::Byte *const end = Serializer<ValueType<F>, Props>::Write(ValueOf(F::Get(value)), begin);
+                        if ((end == nullptr) || (static_cast<std::uint64_t>(end - begin) > TlvLength::kMax))
+                        {
+                            return nullptr;
+                        }
+                        TlvLength::Store(out, static_cast<std::uint64_t>(end - begin));
+                        return end;
+                    }
+
+                    template <typename M>
+                    static void Assign(M &member, M &&element)
+                    {
+                        member = std::move(element);
+                    }
+
+                    template <typename M>
+                    static void Assign(ara::core::Optional<M> &member, M &&element)
+                    {
+                        member.emplace(std::move(element));
+                    }
+
+                    template <typename M>
+                    static void Reset(M &) noexcept
+                    {
+                    }
+
+                    template <typename M>
+                    static void Reset(ara::core::Optional<M> &member) noexcept
+                    {
+                        member.reset();
+                    }
+
+                    /**
+                     * \brief Reads the member F if it has dataId; in points behind the tag, and [in, stop) covers
+                     *        the member including its length fields.
+                     * 
+                     */
+                    template <std::size_t I, typename F>
+                    static bool ReadMember(std::uint16_t dataId, std::uint16_t wireType, ara::core::Byte const *in, ara::core::Byte const *stop, T &value, std::uint64_t &found)
+                    {
+                        if ((dataId != F::kDataId) || ((found & (std::uint64_t{1U} << I)) != 0U))
+                        {
+                            return true;
+                        }
+                        if (wireType != TlvWireType<ValueType<F>, Props>::value)
+                        {
+                            return false;
+                        }
+                        in += TlvExtraLengthSize<ValueType<F>, Props>::value;
+                        ValueType<F> element;
+                        if (!Serializer<ValueType<F>, Props>::Read(in, stop, element) || (in != stop))
+                        {
+                            return false;
+                        }
+                        Assign(F::Get(value), std::move(element));
+                        found |= std::uint64_t{1U} << I;
+                        return true;
+                    }
+
+                    static std::size_t GetSize(T const &value) noexcept
+                    {
+                        return Length::kSize + SumFirst(sizeof...(Fs), {MemberSize<Fs>(value)...});
+                    }
+
+                    static ara::core::Byte* Write(T const &value, ara::core::Byte *out) noexcept
+                    {
+                        ara::core::Byte *const begin = out + Length::kSize;
+                        ara::core::Byte *cursor = begin;
+                        int const expand[] = {0, ((cursor = WriteMember<Fs>(value, cursor)), 0)...};
+                        static_cast<void>(expand);
+                        if ((cursor == nullptr) || (static_cast<std::uint64_t>(cursor - begin) > Length::kMax))
+                        {
+                            return nullptr;
+                        }
+                        Length::Store(out, static_cast<std::uint64_t>(cursor - begin));
+                        return cursor;
+                    }
+
+                    static bool Read(ara::core::Byte const *&in, ara::core::Byte const *end, T &value)
+                    {
+                        ara::core::Byte const *stop;
+                        if (!ReadLength<Length>(in, end, stop))
+                        {
+                            return false;
+                        }
+                        int const reset[] = {0, (Reset(Fs::Get(value)), 0)...};
+                        static_cast<void>(reset);
+                        std::uint64_t found = 0U;
+                        while (in != stop)
+                        {
+                            if (Remaining(in, stop) < Tag::kSize)
+                            {
+                                return false;
+                            }
+                            std::uint32_t const tag = Tag::Load(in);
+                            in += Tag::kSize;
+                            std::uint16_t const wireType = static_cast<std::uint16_t>((tag >> 12U) & 0x7U);
+                            std::uint16_t const dataId = static_cast<std::uint16_t>(tag & 0x0FFFU);
+                            ara::core::Byte const *memberStop;
+                            if (wireType <= 3U)
+                            {
+                                std::size_t const size = std::size_t{1U} << wireType;
+                                if (Remaining(in, stop) < size)
+                                {
+                                    return false;
+                                }
+                                memberStop = in + size;
+                            }
+                            else
+                            {
+                                // The length field stays part of the member: it is either the member's own
+                                // length field or skipped by ReadMember().
+                                ara::core::Byte const *cursor = in;
+                                bool lengthOk;
+                                switch (wireType)
+                                {
+                                case 4U:
+                                    lengthOk = ReadLength<LengthField<Props::byteOrder, Props::arrayLengthFieldSize>>(cursor, stop, memberStop);
+                                    break;
+                                case 5U:
+                                    lengthOk = ReadLength<LengthField<Props::byteOrder, 1U>>(cursor, stop, memberStop);
+                                    break;
+                                case 6U:
+                                    lengthOk = ReadLength<LengthField<Props::byteOrder, 2U>>(cursor, stop, memberStop);
+                                    break;
+                                default:
+                                    lengthOk = ReadLength<TlvLength>(cursor, stop, memberStop);
+                                    break;
+                                }
+                                if (!lengthOk)
+                                {
+                                    return false;
+                                }
+                            }
+                            bool ok = true;
+                            int const expand[] = {0, ((ok = ok && ReadMember<Is, Fs>(dataId, wireType, in, memberStop, value, found)), 0)...};
+                            static_cast<void>(expand);
+                            if (!ok)
+                            {
+                                return false;
+                            }
+                            in = memberStop;
+                        }
+                        bool const required[] = {false, !IsOptional<typename Fs::MemberType>::value...};
+                        for (std::size_t i = 0U; i < sizeof...(Fs); ++i)
+                        {
+                            if (required[i + 1U] && ((found & (std::uint64_t{1U} << i)) == 0U))
+                            {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+                };
+
+                /**
+                 * \brief Selects the struct format: TLV if any member is an ara::core::Optional.
+                 * 
+                 */
+                template <typename Props, typename T, typename Fields>
+                struct StructCodec;
+
+                template <typename Props, typename T, typename... Fs>
+                struct StructCodec<Props, T, std::tuple<Fs...>>
+                    : std::conditional<AnyOf({IsOptional<typename Fs::MemberType>::value...}),
+                                       TlvStruct<Props, T, std::tuple<Fs...>, std::index_sequence_for<Fs...>>,
+                                       SequentialStruct<Props, T, std::tuple<Fs...>, std::index_sequence_for<Fs...>>>::type
+                {
+                };
+            } // namespace detail
+
+            /**
+             * \brief Serializer of structs described by StructTraits.
+             * 
+             */
+            template <typename T, typename Props>
+            struct Serializer<T, Props, typename std::enable_if<detail::HasStructTraits<T>::value>::type>
+                : detail::StructCodec<Props, T, typename StructTraits<T>::Fields>
+            {
+            };
+
+            /**
+             * \brief Whether a type has a serialized size independent of its value.
+             * 
+             * Arithmetic and enumeration types, bool, arrays of fixed-size types, and structs of fixed-size
+             * members without struct length field are fixed-size. For these, the member size holds the
+             * serialized size, and Serialize() and Deserialize() consist of loads and stores at compile-time
+             * offsets after a single bounds check; arrays of arithmetic types in host byte order are copied
+             * with one memcpy.
+             * 
+             * \tparam T        the type
+             * \tparam Props    the transformation properties
+             */
+            template <typename T, typename Props = DefaultSerializationProps, typename Enable = void>
+            struct IsFixedSize : std::false_type
+            {
+                static constexpr std::size_t size = 0U;
+            };
+
+            template <typename T, typename Props>
+            struct IsFixedSize<T, Props, typename std::enable_if<Serializer<T, Props>::kIsFixedSize>::type> : std::true_type
+            {
+                static constexpr std::size_t size = Serializer<T, Props>::kFixedSize;
+            };
+
+            /**
+             * \brief Serialized size of a fixed-size type, 0 for other types.
+             * 
+             * \tparam T        the type
+             * \tparam Props    the transformation properties
+             */
+            template <typename T, typename Props = DefaultSerializationProps>
+            constexpr std::size_t kFixedSerializedSize = IsFixedSize<T, Props>::size;
+
+            /**
+             * \brief Returns the number of bytes Serialize() writes for a value.
+             * 
+             * For fixed-size types this is a constant and value is not read.
+             * 
+             * \tparam T        the type
+             * \tparam Props    the transformation properties
+             * \param[in] value     the value
+             * \return std::size_t  the serialized size in bytes
+             * \note 
+             * \thread safety reentrant
+             */
+            template <typename T, typename Props = DefaultSerializationProps>
+            inline std::size_t GetSerializedSize(T const &value) noexcept
+            {
+                return Serializer<T, Props>::GetSize(value);
+            }
+
+            /**
+             * \brief Serializes a value into a buffer.
+             * 
+             * The buffer size is checked once against GetSerializedSize() before writing, not per member.
+             * 
+             * \tparam T        the type
+             * \tparam Props    the transformation properties
+             * \param[in] value     the value
+             * \param[out] buffer   the buffer to serialize to
+             * \return ara::core::Result<std::size_t>   the number of bytes written, or
+             *                                          kNetworkBindingFailure if buffer is too small or a
+             *                                          length exceeds its length field
+             * \note 
+             * \thread safety reentrant
+             */
+            template <typename T, typename Props = DefaultSerializationProps>
+            inline ara::core::Result<std::size_t> Serialize(T const &value, ara::core::Span<ara::core::Byte> buffer) noexcept
+            {
+                if (buffer.size() < Serializer<T, Props>::GetSize(value))
+                {
+                    return ara::core::Result<std::size_t>::FromError(MakeErrorCode(ComErrc::kNetworkBindingFailure, 0));
+                }
+                ara::core::Byte *const end = Serializer<T, Props>::Write(value, buffer.data());
+                if (end == nullptr)
+                {
+                    return ara::core::Result<std::size_t>::FromError(MakeErrorCode(ComErrc::kNetworkBindingFailure, 0));
+                }
+                return ara::core::Result<std::size_t>::FromValue(static_cast<std::size_t>(end - buffer.data()));
+            }
+
+            /**
+             * \brief Deserializes a value from a buffer.
+             * 
+             * Length fields are validated against the remaining buffer before the data they cover is read.
+             * 
+             * \tparam T        the type
+             * \tparam Props    the transformation properties
+             * \param[in] buffer    the serialized data
+             * \param[out] value    the value
+             * \return ara::core::Result<std::size_t>   the number of bytes read, or kNetworkBindingFailure if
+             *                                          the data is truncated or malformed
+             * \note noexcept exactly for the types whose Read() does not allocate; for the others,
+             *       std::bad_alloc propagates and value is left in a valid but unspecified state.
+             * \thread safety reentrant
+             */
+            template <typename T, typename Props = DefaultSerializationProps>
+            inline ara::core::Result<std::size_t> Deserialize(ara::core::Span<ara::core::Byte const> buffer, T &value) noexcept(
+                noexcept(Serializer<T, Props>::Read(std::declval<ara::core::Byte const *&>(), std::declval<ara::core::Byte const *>(), value)))
+            {
+                ara::core::Byte const *in = buffer.data();
+                if (!Serializer<T, Props>::Read(in, buffer.data() + buffer.size(), value))
+                {
+                    return ara::core::Result<std::size_t>::FromError(MakeErrorCode(ComErrc::kNetworkBindingFailure, 0));
+                }
+                return ara::core::Result<std::size_t>::FromValue(static_cast<std::size_t>(in - buffer.data()));
+            }
+        } // namespace someip
+        
+    } // namespace com
+    
+} // namespace ara
+
+
+#endif // ARA_COM_SOMEIP_SERIALIZER_H_
@@ -7,4 +7,171 @@
  * 
  * \copyright Copyright (c) 2020
  * 
- */
\ No newline at end of file
+ */
+#ifndef ARA_COM_TYPES_H_
+#define ARA_COM_TYPES_H_
+
+#include <cstdint>
+#include "ara/core/result.h"
+
+namespace ara
+{
+    namespace com
+    {
+        /**
+         * \brief Subscription state of a proxy event.
+         * 
+         */
+        enum class SubscriptionState : uint8_t
+        {
+            kSubscribed = 0,            /*< The event is subscribed and samples are received. */
+            kNotSubscribed = 1,         /*< The event is not subscribed. */
+            kSubscriptionPending = 2,   /*< The subscription has been requested but not yet acknowledged. */
+        };
+
+        /**
+         * \brief Pointer to an event sample received by a proxy.
+         * 
+         * With a shared-memory binding, the pointer references the sample in the shared segment the skeleton
+         * wrote it to; it holds one reference on the sample slot, and the slot returns to the publisher's pool
+         * when the last SamplePtr referencing it is destroyed. SamplePtr is movable but not copyable, so the
+         * number of SamplePtrs an application holds is bounded by the maxSampleCount given to Subscribe().
+         * 
+         * \tparam T    the sample type
+         */
+        template <typename T>
+        class SamplePtr
+        {
+            /**
+             * \brief Constructs an empty SamplePtr.
+             * 
+             */
+            constexpr SamplePtr() noexcept;
+
+            /**
+             * \brief The copy constructor for SamplePtr shall not be used.
+             * 
+             */
+            SamplePtr(SamplePtr const &) = delete;
+
+            /**
+             * \brief Move constructor. other is empty afterwards.
+             * 
+             * \param[in] other     the SamplePtr to move from
+             */
+            SamplePtr(SamplePtr &&other) noexcept;
+
+            /**
+             * \brief The copy assignment operator for SamplePtr shall not be used.
+             * 
+             */
+            SamplePtr& operator=(SamplePtr const &) = delete;
+
+            /**
+             * \brief Move assignment. Releases the currently referenced sample first.
+             * 
+             * \param[in] other     the SamplePtr to move from
+             * \return SamplePtr&   *this
+             */
+            SamplePtr& operator=(SamplePtr &&other) noexcept;
+
+            /**
+             * \brief Destructor. Releases the reference on the sample.
+             * 
+             */
+            ~SamplePtr() noexcept;
+
+            /**
+             * \brief Accesses the sample.
+             * 
+             * \return T const&     the sample
+             */
+            T const& operator*() const noexcept;
+
+            /**
+             * \brief Accesses the sample.
+             * 
+             * \return T const*     the sample
+             */
+            T const* operator->() const noexcept;
+
+            /**
+             * \brief Returns the referenced sample.
+             * 
+             * \return T const*     the sample, or nullptr if the SamplePtr is empty
+             */
+            T const* Get() const noexcept;
+
+            /**
+             * \brief Checks whether a sample is referenced.
+             * 
+             * \return true     if a sample is referenced
+             * \return false    otherwise
+             */
+            explicit operator bool() const noexcept;
+
+            /**
+             * \brief Releases the reference on the sample; the SamplePtr is empty afterwards.
+             * 
+             */
+            void Reset() noexcept;
+        };
+
+        /**
+         * \brief Pointer to a sample allocated by a skeleton event, to be filled and sent.
+         * 
+         * With a shared-memory binding, the sample lives in a slot of the shared segment from the start: the
+         * application constructs the data in place and Send() publishes the slot itself, so the data is never
+         * copied. Destroying a SampleAllocateePtr without sending it returns the slot to the pool.
+         * 
+         * \tparam T    the sample type
+         */
+        template <typename T>
+        class SampleAllocateePtr
+        {
+            /**
+             * \brief The copy constructor for SampleAllocateePtr shall not be used.
+             * 
+             */
+            SampleAllocateePtr(SampleAllocateePtr const &) = delete;
+
+            /**
+             * \brief Move constructor. other is empty afterwards.
+             * 
+             * \param[in] other     the SampleAllocateePtr to move from
+             */
+            SampleAllocateePtr(SampleAllocateePtr &&other) noexcept;
+
+            /**
+             * \brief Destructor. Returns an unsent sample slot to the pool.
+             * 
+             */
+            ~SampleAllocateePtr() noexcept;
+
+            /**
+             * \brief Accesses the sample.
+             * 
+             * \return T&   the sample
+             */
+            T& operator*() const noexcept;
+
+            /**
+             * \brief Accesses the sample.
+             * 
+             * \return T*   the sample
+             */
+            T* operator->() const noexcept;
+
+            /**
+             * \brief Returns the sample.
+             * 
+             * \return T*   the sample, or nullptr if the pointer is empty
+             */
+            T* Get() const noexcept;
+        };
+    } // namespace com
+    
+} // namespace ara
+
+
+#endif // ARA_COM_TYPES_H_
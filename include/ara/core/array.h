@@ -0,0 +1,35 @@
+/**
+ * \file array.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_CORE_ARRAY_H_
+#define ARA_CORE_ARRAY_H_
+
+#include <array>
+#include <cstddef>
+
+namespace ara
+{
+    namespace core
+    {
+        // SWS_CORE_01201
+        /**
+         * \brief A container that encapsulates fixed size arrays.
+         * 
+         * \tparam T    the type of contained values
+         * \tparam N    the number of elements in this Array
+         */
+        template <typename T, std::size_t N>
+        using Array = std::array<T, N>;
+    } // namespace core
+    
+} // namespace ara
+
+
+#endif // ARA_CORE_ARRAY_H_
@@ -11,7 +11,9 @@
 #ifndef ARA_CORE_ERROR_CODE_H_
 #define ARA_CORE_ERROR_CODE_H_
 
+#include <type_traits>
 #include "ara/core/error_domain.h"
+#include "ara/core/string_view.h"
 
 namespace ara
 {
@@ -27,29 +29,38 @@ namespace ara
          */
         class ErrorCode final
         {
+        public:
             // SWS_CORE_00512
             /**
              * \brief Construct a new ErrorCode instance with parameters.
              * 
              * This constructor does not participate in overload resolution unless EnumT is an enum type.
+             * The ErrorCode is obtained from the MakeErrorCode overload for EnumT, found by argument-dependent
+             * lookup in the namespace of EnumT.
              * 
              * \tparam EnumT    an enum type that contains error code values
              * 
              * \param e     a domain-specific error code value
              * \param data  optional vendor-specific supplementary error context data
              */
-            template <typename EnumT>
-            constexpr ErrorCode(EnumT e, ErrorDomain::SupportDataType data=ErrorDomain::SupportDataType()) noexcept;
+            template <typename EnumT, typename = typename std::enable_if<std::is_enum<EnumT>::value>::type>
+            constexpr ErrorCode(EnumT e, ErrorDomain::SupportDataType data=ErrorDomain::SupportDataType()) noexcept :
+                ErrorCode(MakeErrorCode(e, data))
+            {
+            }
 
             // SWS_CORE_00513
             /**
              * \brief Construct a new ErrorCode instance with parameters.
-             *
+             * 
              * \param value     a domain-specific error code value
              * \param domain    the ErrorDomain associated with value
              * \param data      optional vendor-specific supplementary error context data
              */
-            constexpr ErrorCode(ErrorDomain::CodeType value, ErrorDomain const &domain, ErrorDomain::SupportDataType data=ErrorDomain::SupportDataType()) noexcept;
+            constexpr ErrorCode(ErrorDomain::CodeType value, ErrorDomain const &domain, ErrorDomain::SupportDataType data=ErrorDomain::SupportDataType()) noexcept :
+                mValue{value}, mSupportData{data}, mDomain{&domain}
+            {
+            }
 
             // SWS_CORE_00514
             /**
@@ -57,7 +68,10 @@ namespace ara
              * 
              * \return constexpr ErrorDomain::CodeType  the raw error code value
              */
-            constexpr ErrorDomain::CodeType Value() const noexcept;
+            constexpr ErrorDomain::CodeType Value() const noexcept
+            {
+                return mValue;
+            }
 
             // SWS_CORE_00515
             /**
@@ -65,7 +79,10 @@ namespace ara
              * 
              * \return constexpr ErrorDomain const&     the ErrorDomain
              */
-            constexpr ErrorDomain const& Domain() const noexcept;
+            constexpr ErrorDomain const& Domain() const noexcept
+            {
+                return *mDomain;
+            }
 
             // SWS_CORE_00516
             /**
@@ -75,7 +92,10 @@ namespace ara
              * 
              * \return constexpr ErrorDomain::SupportDataType   the supplementary error context data
              */
-            constexpr ErrorDomain::SupportDataType SupportData() const noexcept;
+            constexpr ErrorDomain::SupportDataType SupportData() const noexcept
+            {
+                return mSupportData;
+            }
 
             // SWS_CORE_00518
             /**
@@ -83,7 +103,10 @@ namespace ara
              * 
              * \return StringView   the error message text
              */
-            StringView Message() const noexcept;
+            StringView Message() const noexcept
+            {
+                return StringView(mDomain->Message(mValue));
+            }
 
             // SWS_CORE_00519
             /**
@@ -93,7 +116,15 @@ namespace ara
              * thrown exception will contain this ErrorCode.
              * 
              */
-            void ThrowAsException() const;
+            void ThrowAsException() const
+            {
+                mDomain->ThrowAsException(*this);
+            }
+
+        private:
+            ErrorDomain::CodeType mValue;               /*< The domain-specific error code value. */
+            ErrorDomain::SupportDataType mSupportData;  /*< The supplementary error context data. */
+            ErrorDomain const *mDomain;                 /*< The domain of mValue; never nullptr. */
         };
 
         // SWS_CORE_00571
@@ -109,7 +140,10 @@ namespace ara
          * \return true     if the two instances compare equal
          * \return false    otherwise
          */
-        constexpr bool operator==(ErrorCode const &lhs, ErrorCode const &rhs) noexcept;
+        constexpr bool operator==(ErrorCode const &lhs, ErrorCode const &rhs) noexcept
+        {
+            return (lhs.Domain() == rhs.Domain()) && (lhs.Value() == rhs.Value());
+        }
 
         // SWS_CORE_00572
         /**
@@ -120,11 +154,14 @@ namespace ara
          * 
          * \param[in] lhs   the left hand side of the comparison 
          * \param[in] rhs   the right hand side of the comparison
-         *
+         * 
          * \return true     if the two instances compare not equal
          * \return false    otherwise
          */
-        constexpr bool operator!=(ErrorCode const &lhs, ErrorCode const &rhs) noexcept;
+        constexpr bool operator!=(ErrorCode const &lhs, ErrorCode const &rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
     } // namespace core
     
 } // namespace ara
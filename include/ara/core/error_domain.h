@@ -17,7 +17,7 @@ namespace ara
 {
     namespace core
     {
-        #define IMPLEMENTATION_DEFINED std::int32_t
+        class ErrorCode;
 
         // SWS_CORE_00110
         /**
@@ -30,6 +30,7 @@ namespace ara
          */
         class ErrorDomain
         {
+        public:
             // SWS_CORE_00121
             /**
              * \brief Alias type for a unique ErrorDomain identifier type .
@@ -49,7 +50,7 @@ namespace ara
              * \brief Alias type for vendor-specific supplementary data .
              * 
              */
-            using SupportDataType = IMPLEMENTATION_DEFINED;
+            using SupportDataType = std::int32_t;
 
             // SWS_CORE_00131
             /**
@@ -63,8 +64,23 @@ namespace ara
              * \brief Move construction shall be disabled.
              * 
              */
-            ErrorDomain(ErrorDomain const &&)=delete;
+            ErrorDomain(ErrorDomain &&)=delete;
 
+            // SWS_CORE_00133
+            /**
+             * \brief Copy assignment shall be disabled.
+             * 
+             */
+            ErrorDomain& operator=(ErrorDomain const &)=delete;
+
+            // SWS_CORE_00134
+            /**
+             * \brief Move assignment shall be disabled.
+             * 
+             */
+            ErrorDomain& operator=(ErrorDomain &&)=delete;
+
+        protected:
             // SWS_CORE_00135
             /**
              * \brief Construct a new instance with the given identifier.
@@ -72,7 +88,9 @@ namespace ara
              * Identifiers are expected to be system-wide unique.
              * 
              */
-            explicit constexpr ErrorDomain(IdType id) noexcept;
+            explicit constexpr ErrorDomain(IdType id) noexcept : mId{id}
+            {
+            }
 
             // SWS_CORE_00136
             /**
@@ -84,20 +102,7 @@ namespace ara
              */
             ~ErrorDomain()=default;
 
-            // SWS_CORE_00133
-            /**
-             * \brief Copy assignment shall be disabled.
-             * 
-             */
-            ErrorDomain& operator=(ErrorDomain const &)=delete;
-
-            // SWS_CORE_00134
-            /**
-             * \brief Move assignment shall be disabled.
-             * 
-             */
-            ErrorDomain& operator=(ErrorDomain const &&)=delete;
-
+        public:
             // SWS_CORE_00137
             /**
              * \brief Compare for equality with another ErrorDomain instance.
@@ -109,7 +114,10 @@ namespace ara
              * \return true         if other is equal to *this
              * \return false        otherwise
              */
-            constexpr bool operator==(ErrorDomain const &other) const noexcept;
+            constexpr bool operator==(ErrorDomain const &other) const noexcept
+            {
+                return mId == other.mId;
+            }
 
             // SWS_CORE_00138
             /**
@@ -120,7 +128,10 @@ namespace ara
              * \return true         if other is not equal to *this
              * \return false        otherwise
              */
-            constexpr bool operator!=(ErrorDomain const &other) const noexcept;
+            constexpr bool operator!=(ErrorDomain const &other) const noexcept
+            {
+                return mId != other.mId;
+            }
 
             // SWS_CORE_00151
             /**
@@ -128,7 +139,10 @@ namespace ara
              * 
              * \return constexpr IdType     the identifier
              */
-            constexpr IdType Id() const noexcept;
+            constexpr IdType Id() const noexcept
+            {
+                return mId;
+            }
 
             // SWS_CORE_00152
             /**
@@ -166,6 +180,9 @@ namespace ara
              * \param[in] errorCode     the ErrorCode
              */
             virtual void ThrowAsException(ErrorCode const &errorCode) const noexcept(false) = 0;
+
+        private:
+            IdType mId; /*< The system-wide unique identifier. */
         };
     } // namespace core
     
@@ -11,6 +11,7 @@
 #ifndef ARA_CORE_EXCEPTION_H_
 #define ARA_CORE_EXCEPTION_H_
 
+#include <exception>
 #include "ara/core/error_code.h"
 
 namespace ara
@@ -22,7 +23,7 @@ namespace ara
          * \brief Base type for all AUTOSAR exception types.
          * 
          */
-        class Exception : public exception
+        class Exception : public std::exception
         {
         public:
 
@@ -32,7 +33,9 @@ namespace ara
              * 
              * \param[in] err   the ErrorCode
              */
-            explicit Exception(ErrorCode err) noexcept;
+            explicit Exception(ErrorCode err) noexcept : mErrorCode{err}
+            {
+            }
 
             // SWS_CORE_00612
             /**
@@ -43,7 +46,10 @@ namespace ara
              * 
              * \return char const*  a null-terminated string
              */
-            char const* what() const noexcept override;
+            char const* what() const noexcept override
+            {
+                return mErrorCode.Domain().Message(mErrorCode.Value());
+            }
 
             // SWS_CORE_00613
             /**
@@ -51,7 +57,13 @@ namespace ara
              * 
              * \return ErrorCode const&     reference to the embedded ErrorCode
              */
-            ErrorCode const& Error() const noexcept;
+            ErrorCode const& Error() const noexcept
+            {
+                return mErrorCode;
+            }
+
+        private:
+            ErrorCode mErrorCode;   /*< The embedded ErrorCode. */
         };
     } // namespace core
     
@@ -0,0 +1,39 @@
+/**
+ * \file map.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_CORE_MAP_H_
+#define ARA_CORE_MAP_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace ara
+{
+    namespace core
+    {
+        // SWS_CORE_01400
+        /**
+         * \brief A container that contains key-value pairs with unique keys.
+         * 
+         * \tparam K            the type of keys in this Map
+         * \tparam V            the type of values in this Map
+         * \tparam C            the type of comparison Callable
+         * \tparam Allocator    the type of Allocator to use for this container
+         */
+        template <typename K, typename V, typename C = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+        using Map = std::map<K, V, C, Allocator>;
+    } // namespace core
+    
+} // namespace ara
+
+
+#endif // ARA_CORE_MAP_H_
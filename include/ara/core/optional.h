@@ -0,0 +1,563 @@
+/**
+ * \file optional.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_CORE_OPTIONAL_H_
+#define ARA_CORE_OPTIONAL_H_
+
+#include <exception>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "ara/core/utility.h"
+
+namespace ara
+{
+    namespace core
+    {
+        /**
+         * \brief Type of nullopt, which denotes an Optional without value.
+         * 
+         */
+        struct nullopt_t
+        {
+            struct Tag
+            {
+            };
+
+            constexpr explicit nullopt_t(Tag) noexcept
+            {
+            }
+        };
+
+        /**
+         * \brief The instance of nullopt_t.
+         * 
+         */
+        constexpr nullopt_t nullopt{nullopt_t::Tag{}};
+
+        /**
+         * \brief A container which either holds a value of type T or no value, in the manner of C++17
+         *        std::optional.
+         * 
+         * Accessing the value of an Optional without value by operator*, operator-> or value() is a
+         * violation and terminates the process; no exception is thrown.
+         * 
+         * \tparam T    the type of the contained value
+         */
+        template <typename T>
+        class Optional final
+        {
+            static_assert(!std::is_reference<T>::value, "Optional of a reference is not supported");
+            static_assert(!std::is_same<typename std::remove_cv<T>::type, nullopt_t>::value, "Optional of nullopt_t is not supported");
+            static_assert(!std::is_same<typename std::remove_cv<T>::type, in_place_t>::value, "Optional of in_place_t is not supported");
+
+        public:
+            /**
+             * \brief Alias for the type of the contained value.
+             * 
+             */
+            using value_type = T;
+
+            /**
+             * \brief Constructs an Optional without value.
+             * 
+             */
+            constexpr Optional() noexcept : mEmpty{}, mHasValue{false}
+            {
+            }
+
+            /**
+             * \brief Constructs an Optional without value.
+             * 
+             */
+            constexpr Optional(nullopt_t) noexcept : mEmpty{}, mHasValue{false}
+            {
+            }
+
+            /**
+             * \brief Copy constructor.
+             * 
+             * \param[in] other     the Optional to copy
+             */
+            Optional(Optional const &other) : mEmpty{}, mHasValue{false}
+            {
+                if (other.mHasValue)
+                {
+                    Construct(other.mValue);
+                }
+            }
+
+            /**
+             * \brief Move constructor; other keeps its (moved-from) value.
+             * 
+             * \param[in] other     the Optional to move from
+             */
+            Optional(Optional &&other) noexcept(std::is_nothrow_move_constructible<T>::value) : mEmpty{}, mHasValue{false}
+            {
+                if (other.mHasValue)
+                {
+                    Construct(std::move(other.mValue));
+                }
+            }
+
+            /**
+             * \brief Constructs the value in place.
+             * 
+             * \param[in] args  the arguments of the constructor of T
+             */
+            template <typename... Args, typename = typename std::enable_if<std::is_constructible<T, Args&&...>::value>::type>
+            constexpr explicit Optional(in_place_t, Args &&... args) : mValue(std::forward<Args>(args)...), mHasValue{true}
+            {
+            }
+
+            /**
+             * \brief Constructs an Optional holding a value converted from value.
+             * 
+             * \param[in] value     the value
+             */
+            template <typename U = T, typename = typename std::enable_if<
+                std::is_constructible<T, U&&>::value &&
+                !std::is_same<typename std::decay<U>::type, in_place_t>::value &&
+                !std::is_same<typename std::decay<U>::type, Optional>::value>::type>
+            constexpr Optional(U &&value) : mValue(std::forward<U>(value)), mHasValue{true}
+            {
+            }
+
+            /**
+             * \brief Destructor. Destroys the value, if any.
+             * 
+             */
+            ~Optional()
+            {
+                reset();
+            }
+
+            /**
+             * \brief Destroys the value, if any.
+             * 
+             * \return Optional&    *this
+             */
+            Optional& operator=(nullopt_t) noexcept
+            {
+                reset();
+                return *this;
+            }
+
+            /**
+             * \brief Copy assignment.
+             * 
+             * \param[in] other     the Optional to copy
+             * \return Optional&    *this
+             */
+            Optional& operator=(Optional const &other)
+            {
+                if (this != &other)
+                {
+                    Assign(other.mHasValue, other.mValue);
+                }
+                return *this;
+            }
+
+            /**
+             * \brief Move assignment; other keeps its (moved-from) value.
+             * 
+             * \param[in] other     the Optional to move from
+             * \return Optional&    *this
+             */
+            Optional& operator=(Optional &&other) noexcept(std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value)
+            {
+                if (this != &other)
+                {
+                    Assign(other.mHasValue, std::move(other.mValue));
+                }
+                return *this;
+            }
+
+            /**
+             * \brief Assigns a value converted from value.
+             * 
+             * \param[in] value     the value
+             * \return Optional&    *this
+             */
+            template <typename U = T, typename = typename std::enable_if<
+                std::is_constructible<T, U&&>::value && std::is_assignable<T&, U&&>::value &&
+                !std::is_same<typename std::decay<U>::type, Optional>::value>::type>
+            Optional& operator=(U &&value)
+            {
+                Assign(true, std::forward<U>(value));
+                return *this;
+            }
+
+            /**
+             * \brief Destroys the value, if any, and constructs a new one in place.
+             * 
+             * \param[in] args  the arguments of the constructor of T
+             * \return T&       the new value
+             */
+            template <typename... Args>
+            T& emplace(Args &&... args)
+            {
+                reset();
+                Construct(std::forward<Args>(args)...);
+                return mValue;
+            }
+
+            /**
+             * \brief Exchanges the states of two Optionals.
+             * 
+             * \param[in,out] other     the other Optional
+             */
+            void swap(Optional &other) noexcept(std::is_nothrow_move_constructible<T>::value && noexcept(std::swap(std::declval<T&>(), std::declval<T&>())))
+            {
+                if (mHasValue && other.mHasValue)
+                {
+                    using std::swap;
+                    swap(mValue, other.mValue);
+                }
+                else if (mHasValue)
+                {
+                    other.Construct(std::move(mValue));
+                    reset();
+                }
+                else if (other.mHasValue)
+                {
+                    Construct(std::move(other.mValue));
+                    other.reset();
+                }
+            }
+
+            /**
+             * \brief Destroys the value, if any.
+             * 
+             */
+            void reset() noexcept
+            {
+                if (mHasValue)
+                {
+                    mValue.~T();
+                    mHasValue = false;
+                }
+            }
+
+            /**
+             * \brief Returns whether the Optional holds a value.
+             * 
+             * \return true     if it holds a value
+             * \return false    otherwise
+             */
+            constexpr bool has_value() const noexcept
+            {
+                return mHasValue;
+            }
+
+            /**
+             * \brief Returns whether the Optional holds a value.
+             * 
+             * \return true     if it holds a value
+             * \return false    otherwise
+             */
+            constexpr explicit operator bool() const noexcept
+            {
+                return mHasValue;
+            }
+
+            /**
+             * \brief Returns a pointer to the value.
+             * 
+             * \return T*  the value
+             */
+            T* operator->() noexcept
+            {
+                return std::addressof(Checked());
+            }
+
+            /**
+             * \brief Returns a pointer to the value.
+             * 
+             * \return T const*    the value
+             */
+            T const* operator->() const noexcept
+            {
+                return std::addressof(Checked());
+            }
+
+            /**
+             * \brief Returns the value.
+             * 
+             * \return T&  the value
+             */
+            T& operator*() & noexcept
+            {
+                return Checked();
+            }
+
+            /**
+             * \brief Returns the value.
+             * 
+             * \return T const&    the value
+             */
+            T const& operator*() const & noexcept
+            {
+                return Checked();
+            }
+
+            /**
+             * \brief Returns the value as rvalue.
+             * 
+             * \return T&&     the value
+             */
+            T&& operator*() && noexcept
+            {
+                return std::move(Checked());
+            }
+
+            /**
+             * \brief Returns the value.
+             * 
+             * \return T&  the value
+             */
+            T& value() & noexcept
+            {
+                return Checked();
+            }
+
+            /**
+             * \brief Returns the value.
+             * 
+             * \return T const&    the value
+             */
+            T const& value() const & noexcept
+            {
+                return Checked();
+            }
+
+            /**
+             * \brief Returns the value as rvalue.
+             * 
+             * \return T&&     the value
+             */
+            T&& value() && noexcept
+            {
+                return std::move(Checked());
+            }
+
+            /**
+             * \brief Returns the value, or defaultValue if there is none.
+             * 
+             * \param[in] defaultValue  the value to return if there is no value
+             * \return T                the value or defaultValue
+             */
+            template <typename U>
+            T value_or(U &&defaultValue) const &
+            {
+                return mHasValue ? mValue : static_cast<T>(std::forward<U>(defaultValue));
+            }
+
+            /**
+             * \brief Returns the value, or defaultValue if there is none; the value is moved out.
+             * 
+             * \param[in] defaultValue  the value to return if there is no value
+             * \return T                the value or defaultValue
+             */
+            template <typename U>
+            T value_or(U &&defaultValue) &&
+            {
+                return mHasValue ? std::move(mValue) : static_cast<T>(std::forward<U>(defaultValue));
+            }
+
+        private:
+            template <typename... Args>
+            void Construct(Args &&... args)
+            {
+                ::new (static_cast<void*>(std::addressof(mValue))) T(std::forward<Args>(args)...);
+                mHasValue = true;
+            }
+
+            template <typename U>
+            void Assign(bool hasValue, U &&value)
+            {
+                if (!hasValue)
+                {
+                    reset();
+                }
+                else if (mHasValue)
+                {
+                    mValue = std::forward<U>(value);
+                }
+                else
+                {
+                    Construct(std::forward<U>(value));
+                }
+            }
+
+            T& Checked() noexcept
+            {
+                if (!mHasValue)
+                {
+                    std::terminate();
+                }
+                return mValue;
+            }
+
+            T const& Checked() const noexcept
+            {
+                if (!mHasValue)
+                {
+                    std::terminate();
+                }
+                return mValue;
+            }
+
+            union
+            {
+                char mEmpty;
+                T mValue;
+            };
+            bool mHasValue;
+        };
+
+        /**
+         * \brief Creates an Optional holding value.
+         * 
+         * \param[in] value         the value
+         * \return Optional<...>    the Optional
+         */
+        template <typename T>
+        Optional<typename std::decay<T>::type> make_optional(T &&value)
+        {
+            return Optional<typename std::decay<T>::type>(std::forward<T>(value));
+        }
+
+        /**
+         * \brief Compares two Optionals; they are equal if both hold no value or both hold equal values.
+         * 
+         */
+        template <typename T>
+        bool operator==(Optional<T> const &lhs, Optional<T> const &rhs)
+        {
+            return (lhs.has_value() == rhs.has_value()) && (!lhs.has_value() || (*lhs == *rhs));
+        }
+
+        /**
+         * \brief Compares two Optionals for inequality.
+         * 
+         */
+        template <typename T>
+        bool operator!=(Optional<T> const &lhs, Optional<T> const &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * \brief Orders two Optionals; an Optional without value is less than any Optional with value.
+         * 
+         */
+        template <typename T>
+        bool operator<(Optional<T> const &lhs, Optional<T> const &rhs)
+        {
+            return rhs.has_value() && (!lhs.has_value() || (*lhs < *rhs));
+        }
+
+        /**
+         * \brief Returns whether lhs holds no value.
+         * 
+         */
+        template <typename T>
+        bool operator==(Optional<T> const &lhs, nullopt_t) noexcept
+        {
+            return !lhs.has_value();
+        }
+
+        /**
+         * \brief Returns whether rhs holds no value.
+         * 
+         */
+        template <typename T>
+        bool operator==(nullopt_t, Optional<T> const &rhs) noexcept
+        {
+            return !rhs.has_value();
+        }
+
+        /**
+         * \brief Returns whether lhs holds a value.
+         * 
+         */
+        template <typename T>
+        bool operator!=(Optional<T> const &lhs, nullopt_t) noexcept
+        {
+            return lhs.has_value();
+        }
+
+        /**
+         * \brief Returns whether rhs holds a value.
+         * 
+         */
+        template <typename T>
+        bool operator!=(nullopt_t, Optional<T> const &rhs) noexcept
+        {
+            return rhs.has_value();
+        }
+
+        /**
+         * \brief Returns whether lhs holds a value equal to rhs.
+         * 
+         */
+        template <typename T>
+        bool operator==(Optional<T> const &lhs, T const &rhs)
+        {
+            return lhs.has_value() && (*lhs == rhs);
+        }
+
+        /**
+         * \brief Returns whether rhs holds a value equal to lhs.
+         * 
+         */
+        template <typename T>
+        bool operator==(T const &lhs, Optional<T> const &rhs)
+        {
+            return rhs.has_value() && (lhs == *rhs);
+        }
+
+        /**
+         * \brief Returns whether lhs holds no value or a value different from rhs.
+         * 
+         */
+        template <typename T>
+        bool operator!=(Optional<T> const &lhs, T const &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * \brief Returns whether rhs holds no value or a value different from lhs.
+         * 
+         */
+        template <typename T>
+        bool operator!=(T const &lhs, Optional<T> const &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * \brief Exchanges the states of two Optionals.
+         * 
+         */
+        template <typename T>
+        void swap(Optional<T> &lhs, Optional<T> &rhs) noexcept(noexcept(lhs.swap(rhs)))
+        {
+            lhs.swap(rhs);
+        }
+    } // namespace core
+    
+} // namespace ara
+
+
+#endif // ARA_CORE_OPTIONAL_H_
@@ -11,12 +11,73 @@
 #ifndef ARA_CORE_RESULT_H_
 #define ARA_CORE_RESULT_H_
 
-#include "error_code.h"
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "ara/core/error_code.h"
 
 namespace ara
 {
     namespace core
     {
+        template<typename T, typename E>
+        class Result;
+
+        namespace internal
+        {
+            template<typename U>
+            struct IsResult : std::false_type
+            {
+            };
+
+            template<typename U, typename G>
+            struct IsResult<Result<U, G>> : std::true_type
+            {
+            };
+
+            /**
+             * \brief Whether the first of Args is neither T nor a Result, as required by the in-place
+             *        factories; true for an empty pack.
+             * 
+             */
+            template<typename T, typename... Args>
+            struct FirstArgIsNot : std::true_type
+            {
+            };
+
+            template<typename T, typename A, typename... Args>
+            struct FirstArgIsNot<T, A, Args...> : std::integral_constant<bool,
+                !std::is_same<typename std::decay<A>::type, T>::value &&
+                !IsResult<typename std::decay<A>::type>::value>
+            {
+            };
+
+            /**
+             * \brief The return type of Result<T, E>::Bind for a Callable returning U.
+             * 
+             */
+            template<typename U, typename E>
+            struct BindResult
+            {
+                using type = Result<U, E>;
+            };
+
+            template<typename U, typename G, typename E>
+            struct BindResult<Result<U, G>, E>
+            {
+                using type = Result<U, G>;
+            };
+
+            struct ValueTag
+            {
+            };
+
+            struct ErrorTag
+            {
+            };
+        } // namespace internal
+
         // SWS_CORE_00701
         /**
          * \brief This class is a type that contains either a value or an error.
@@ -27,6 +88,7 @@ namespace ara
         template<typename T, typename E = ErrorCode>
         class Result final
         {
+        public:
             // SWS_CORE_00711
             /**
              * \brief Type alias for the type T of values .
@@ -45,7 +107,10 @@ namespace ara
              * 
              * \param[in] t     the value to put into the Result
              */
-            Result(T const &t);
+            Result(T const &t) : mHasValue{false}
+            {
+                ConstructValue(t);
+            }
 
             // SWS_CORE_00722
             /**
@@ -53,7 +118,10 @@ namespace ara
              * 
              * \param[in] t     the value to put into the Result
              */
-            Result(T const &&t);
+            Result(T &&t) : mHasValue{false}
+            {
+                ConstructValue(std::move(t));
+            }
 
             // SWS_CORE_00723
             /**
@@ -61,7 +129,10 @@ namespace ara
              * 
              * \param[in] e     the error to put into the Result
              */
-            Result(E const &e);
+            Result(E const &e) : mHasValue{false}
+            {
+                ConstructError(e);
+            }
 
             // SWS_CORE_00724
             /**
@@ -69,7 +140,10 @@ namespace ara
              * 
              * \param[in] e     the error to put into the Result
              */
-            Result(E const &&e);
+            Result(E &&e) : mHasValue{false}
+            {
+                ConstructError(std::move(e));
+            }
 
             // SWS_CORE_00725
             /**
@@ -77,7 +151,17 @@ namespace ara
              * 
              * \param[in] other     the other instance
              */
-            Result(Result const &other);
+            Result(Result const &other) : mHasValue{false}
+            {
+                if (other.mHasValue)
+                {
+                    ConstructValue(other.mValue);
+                }
+                else
+                {
+                    ConstructError(other.mError);
+                }
+            }
 
             // SWS_CORE_00726
             /**
@@ -85,7 +169,18 @@ namespace ara
              * 
              * \param[in] other     the other instance
              */
-            Result(Result const &&other) noexcept(std:is_nothrow_move_constructible<T>::value &&std::is_nothrow_move_constructible<E>::value);
+            Result(Result &&other) noexcept(std::is_nothrow_move_constructible<T>::value &&std::is_nothrow_move_constructible<E>::value) :
+                mHasValue{false}
+            {
+                if (other.mHasValue)
+                {
+                    ConstructValue(std::move(other.mValue));
+                }
+                else
+                {
+                    ConstructError(std::move(other.mError));
+                }
+            }
 
             // SWS_CORE_00727
             /**
@@ -95,7 +190,10 @@ namespace ara
              * destructible<E>::value is true.
              * 
              */
-            ~Result();
+            ~Result()
+            {
+                Destroy();
+            }
 
             // SWS_CORE_00731
             /**
@@ -105,7 +203,10 @@ namespace ara
              * 
              * \return Result   a Result that contains the value t
              */
-            static Result FromValue(T const &t);
+            static Result FromValue(T const &t)
+            {
+                return Result(t);
+            }
 
             // SWS_CORE_00732
             /**
@@ -115,7 +216,10 @@ namespace ara
              * 
              * \return Result   a Result that contains the value t
              */
-            static Result FromValue(T &&t);
+            static Result FromValue(T &&t)
+            {
+                return Result(std::move(t));
+            }
 
             // SWS_CORE_00733
             /**
@@ -130,8 +234,12 @@ namespace ara
              * 
              * \return Result   a Result that contains a value
              */
-            template <typename... Args>
-            static Result FromValue(Args &&... args);
+            template <typename... Args, typename = typename std::enable_if<
+                std::is_constructible<T, Args&&...>::value && internal::FirstArgIsNot<T, Args...>::value>::type>
+            static Result FromValue(Args &&... args)
+            {
+                return Result(internal::ValueTag{}, std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00734
             /**
@@ -141,7 +249,10 @@ namespace ara
              * 
              * \return Result   a Result that contains the error e
              */
-            static Result FromError(E const &e);
+            static Result FromError(E const &e)
+            {
+                return Result(e);
+            }
 
             // SWS_CORE_00735
             /**
@@ -151,7 +262,10 @@ namespace ara
              * 
              * \return Result   a Result that contains the error e
              */
-            static Result FromError(E const &&e);
+            static Result FromError(E &&e)
+            {
+                return Result(std::move(e));
+            }
 
             // SWS_CORE_00736
             /**
@@ -167,8 +281,12 @@ namespace ara
              * 
              * \return Result   a Result that contains an error
              */
-            template <typename.. Args>
-            static Result FromError(Args &&... args);
+            template <typename... Args, typename = typename std::enable_if<
+                std::is_constructible<E, Args&&...>::value && internal::FirstArgIsNot<E, Args...>::value>::type>
+            static Result FromError(Args &&... args)
+            {
+                return Result(internal::ErrorTag{}, std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00741
             /**
@@ -178,7 +296,21 @@ namespace ara
              * 
              * \return Result&      *this, containing the contents of other
              */
-            Result& operator=(Result const &other);
+            Result& operator=(Result const &other)
+            {
+                if (this != &other)
+                {
+                    if (other.mHasValue)
+                    {
+                        AssignValue(other.mValue);
+                    }
+                    else
+                    {
+                        AssignError(other.mError);
+                    }
+                }
+                return *this;
+            }
 
             // SWS_CORE_00742
             /**
@@ -190,7 +322,21 @@ namespace ara
              */
             Result& operator=(Result &&other) noexcept(
                   std::is_nothrow_move_constructible<T>::value &&std::is_nothrow_move_assignable<T>::value 
-                &&std::is_nothrow_move_constructible<E>::value &&std::is_nothrow_move_assignable<E>::value);
+                &&std::is_nothrow_move_constructible<E>::value &&std::is_nothrow_move_assignable<E>::value)
+            {
+                if (this != &other)
+                {
+                    if (other.mHasValue)
+                    {
+                        AssignValue(std::move(other.mValue));
+                    }
+                    else
+                    {
+                        AssignError(std::move(other.mError));
+                    }
+                }
+                return *this;
+            }
 
             // SWS_CORE_00743
             /**
@@ -203,7 +349,11 @@ namespace ara
              * \return None
              */
             template <typename... Args>
-            void EmplaceValue(Args &&... args);
+            void EmplaceValue(Args &&... args)
+            {
+                Destroy();
+                ConstructValue(std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00744
             /**
@@ -214,7 +364,11 @@ namespace ara
              * \param[in] args  the arguments used for constructing the error
              */
             template <typename... Args>
-            void EmplaceError(Args &&... args);
+            void EmplaceError(Args &&... args)
+            {
+                Destroy();
+                ConstructError(std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00745
             /**
@@ -225,7 +379,24 @@ namespace ara
             void Swap(Result &other) noexcept(
                   std::is_nothrow_move_constructible<T>::value &&std::is_nothrow_move_assignable<T>::value
                 &&std::is_nothrow_move_constructible<E>::value &&std::is_nothrow_move_assignable<E>::value
-            );
+            )
+            {
+                using std::swap;
+                if (mHasValue && other.mHasValue)
+                {
+                    swap(mValue, other.mValue);
+                }
+                else if (!mHasValue && !other.mHasValue)
+                {
+                    swap(mError, other.mError);
+                }
+                else
+                {
+                    Result temporary(std::move(other));
+                    other = std::move(*this);
+                    *this = std::move(temporary);
+                }
+            }
 
             // SWS_CORE_00751
             /**
@@ -234,7 +405,10 @@ namespace ara
              * \return true     if *this contains a value
              * \return false    otherwise
              */
-            bool hasValue() const noexcept;
+            bool HasValue() const noexcept
+            {
+                return mHasValue;
+            }
 
             // SWS_CORE_00752
             /**
@@ -243,7 +417,10 @@ namespace ara
              * \return true     if *this contains a value
              * \return false    otherwise
              */
-            explicit operator bool() const noexcept;
+            explicit operator bool() const noexcept
+            {
+                return mHasValue;
+            }
 
             // SWS_CORE_00753
             /**
@@ -253,7 +430,10 @@ namespace ara
              * 
              * \return T const&     a const_reference to the contained value
              */
-            T const& operator*() const &;
+            T const& operator*() const &
+            {
+                return mValue;
+            }
 
             // SWS_CORE_00759
             /**
@@ -263,7 +443,10 @@ namespace ara
              * 
              * \return T&&  an rvalue reference to the contained value
              */
-            T&& operator*() &&;
+            T&& operator*() &&
+            {
+                return std::move(mValue);
+            }
 
             // SWS_CORE_00754
             /**
@@ -273,7 +456,10 @@ namespace ara
              * 
              * \return T const*     a pointer to the contained value
              */
-            T const* operator->() const;
+            T const* operator->() const
+            {
+                return std::addressof(mValue);
+            }
 
             // SWS_CORE_00755
             /**
@@ -283,7 +469,10 @@ namespace ara
              * 
              * \return T const&     a const reference to the contained value
              */
-            T const& Value() const &;
+            T const& Value() const &
+            {
+                return mValue;
+            }
 
             // SWS_CORE_00756
             /**
@@ -293,7 +482,10 @@ namespace ara
              * 
              * \return T&&  an rvalue reference to the contained value
              */
-            T&& Value() &&;
+            T&& Value() &&
+            {
+                return std::move(mValue);
+            }
 
             // SWS_CORE_00757
             /**
@@ -303,7 +495,10 @@ namespace ara
              * 
              * \return E const&     a const reference to the contained error
              */
-            E const& Error() const &;
+            E const& Error() const &
+            {
+                return mError;
+            }
 
             // SWS_CORE_00758
             /**
@@ -313,11 +508,14 @@ namespace ara
              * 
              * \return E&&  an rvalue reference to the contained error
              */
-            E&& Error() const &&;
+            E&& Error() &&
+            {
+                return std::move(mError);
+            }
 
             // SWS_CORE_00761
             /**
-             * \brief eturn the contained value or the given default value.
+             * \brief Return the contained value or the given default value.
              * 
              * If *this contains a value, it is returned. Otherwise, the specified default value is returned, static_
              * cast’d to T.
@@ -329,7 +527,10 @@ namespace ara
              * \return T                the value
              */
             template <typename U>
-            T ValueOr(U &&defaultValue) const &;
+            T ValueOr(U &&defaultValue) const &
+            {
+                return mHasValue ? mValue : static_cast<T>(std::forward<U>(defaultValue));
+            }
 
             // SWS_CORE_00762
             /**
@@ -343,7 +544,10 @@ namespace ara
              * \return T                the value
              */
             template<typename U>
-            T ValueOr(U &&defaultValue) &&;
+            T ValueOr(U &&defaultValue) &&
+            {
+                return mHasValue ? std::move(mValue) : static_cast<T>(std::forward<U>(defaultValue));
+            }
 
             // SWS_CORE_00763
             /**
@@ -357,7 +561,10 @@ namespace ara
              * \return E                the error
              */
             template <typename G>
-            E ErrorOr(G &&defaultValue) const;
+            E ErrorOr(G &&defaultValue) const
+            {
+                return mHasValue ? static_cast<E>(std::forward<G>(defaultValue)) : mError;
+            }
 
             // SWS_CORE_00765
             /**
@@ -372,7 +579,10 @@ namespace ara
              * \return false    otherwise
              */
             template <typename G>
-            bool CheckError(G &&error) const;
+            bool CheckError(G &&error) const
+            {
+                return !mHasValue && (mError == static_cast<E>(std::forward<G>(error)));
+            }
 
             // SWS_CORE_00766
             /**
@@ -383,7 +593,14 @@ namespace ara
              * 
              * \return T const&     a const reference to the contained value
              */
-            T const& ValueOrThrow() const & noexcept(false);
+            T const& ValueOrThrow() const & noexcept(false)
+            {
+                if (!mHasValue)
+                {
+                    mError.ThrowAsException();
+                }
+                return mValue;
+            }
 
             // SWS_CORE_00769
             /**
@@ -396,7 +613,14 @@ namespace ara
              * 
              * \exceptions <TYPE>   the exception type associated with the contained error
              */
-            T&& ValueOrThrow() && noexcept(false);
+            T&& ValueOrThrow() && noexcept(false)
+            {
+                if (!mHasValue)
+                {
+                    mError.ThrowAsException();
+                }
+                return std::move(mValue);
+            }
 
             // SWS_CORE_00767
             /**
@@ -412,7 +636,10 @@ namespace ara
              * \return T        the value
              */
             template <typename F>
-            T Resolve(F &&f) const;
+            T Resolve(F &&f) const
+            {
+                return mHasValue ? mValue : std::forward<F>(f)(mError);
+            }
 
             // SWS_CORE_00768
             /**
@@ -432,10 +659,121 @@ namespace ara
              * 
              * \tparam F            the type of the Callable f
              * \param[in] f         the Callable
-             * \return SEE_BELOW    a new Result instance of the possibly transformed type
+             * \return auto         a new Result instance of the possibly transformed type
              */
             template <typename F>
-            auto Bind(F &&f) const -> SEE_BELOW;
+            auto Bind(F &&f) const -> typename internal::BindResult<typename std::decay<decltype(f(std::declval<T const&>()))>::type, E>::type
+            {
+                using U = typename std::decay<decltype(f(std::declval<T const&>()))>::type;
+                using R = typename internal::BindResult<U, E>::type;
+                if (!mHasValue)
+                {
+                    return R::FromError(mError);
+                }
+                return BindValue<R>(std::forward<F>(f), std::is_void<U>{}, internal::IsResult<U>{});
+            }
+
+        private:
+            template <typename... Args>
+            explicit Result(internal::ValueTag, Args &&... args) : mHasValue{false}
+            {
+                ConstructValue(std::forward<Args>(args)...);
+            }
+
+            template <typename... Args>
+            explicit Result(internal::ErrorTag, Args &&... args) : mHasValue{false}
+            {
+                ConstructError(std::forward<Args>(args)...);
+            }
+
+            template <typename... Args>
+            void ConstructValue(Args &&... args)
+            {
+                ::new (static_cast<void*>(std::addressof(mValue))) T(std::forward<Args>(args)...);
+                mHasValue = true;
+            }
+
+            /**
+             * \brief Constructs the error; mHasValue shall be false and no error shall be alive.
+             * 
+             * \note Whether a Result holds an error is encoded as !mHasValue, so a Result whose value or error
+             * constructor threw is left holding an error that is not alive. Such a Result shall only be
+             * destroyed; this is the same guarantee the standard containers give for throwing element
+             * constructors.
+             */
+            template <typename... Args>
+            void ConstructError(Args &&... args)
+            {
+                ::new (static_cast<void*>(std::addressof(mError))) E(std::forward<Args>(args)...);
+                mHasValue = false;
+            }
+
+            void Destroy() noexcept
+            {
+                if (mHasValue)
+                {
+                    mValue.~T();
+                }
+                else
+                {
+                    mError.~E();
+                }
+                mHasValue = false;
+            }
+
+            template <typename V>
+            void AssignValue(V &&value)
+            {
+                if (mHasValue)
+                {
+                    mValue = std::forward<V>(value);
+                }
+                else
+                {
+                    Destroy();
+                    ConstructValue(std::forward<V>(value));
+                }
+            }
+
+            template <typename G>
+            void AssignError(G &&error)
+            {
+                if (mHasValue)
+                {
+                    Destroy();
+                    ConstructError(std::forward<G>(error));
+                }
+                else
+                {
+                    mError = std::forward<G>(error);
+                }
+            }
+
+            template <typename R, typename F>
+            R BindValue(F &&f, std::true_type /* void */, std::false_type /* Result */) const
+            {
+                std::forward<F>(f)(mValue);
+                return R::FromValue();
+            }
+
+            template <typename R, typename F>
+            R BindValue(F &&f, std::false_type /* void */, std::false_type /* Result */) const
+            {
+                return R::FromValue(std::forward<F>(f)(mValue));
+            }
+
+            template <typename R, typename F>
+            R BindValue(F &&f, std::false_type /* void */, std::true_type /* Result */) const
+            {
+                return std::forward<F>(f)(mValue);
+            }
+
+            union
+            {
+                T mValue;   /*< The value, alive if mHasValue. */
+                E mError;   /*< The error, alive otherwise. */
+            };
+            bool mHasValue; /*< Whether mValue or mError is alive. */
         };
     
         // SWS_CORE_00801
@@ -447,6 +785,7 @@ namespace ara
         template <typename E>
         class Result<void, E> final
         {
+        public:
             // SWS_CORE_00811
             /**
              * \brief Type alias for the type T of values, always "void" for this specialization .
@@ -464,7 +803,9 @@ namespace ara
              * \brief Construct a new Result with a "void" value.
              * 
              */
-            Result() noexcept;
+            Result() noexcept : mHasValue{true}
+            {
+            }
 
             // SWS_CORE_00823
             /**
@@ -472,7 +813,10 @@ namespace ara
              * 
              * \param[in] e     the error to put into the Result
              */
-            explicit Result(E const &e);
+            explicit Result(E const &e) : mHasValue{true}
+            {
+                ConstructError(e);
+            }
 
             // SWS_CORE_00824
             /**
@@ -480,7 +824,10 @@ namespace ara
              * 
              * \param[in] e     the error to put into the Result
              */
-            explicit Result(E &&e);
+            explicit Result(E &&e) : mHasValue{true}
+            {
+                ConstructError(std::move(e));
+            }
 
             // SWS_CORE_00825
             /**
@@ -488,7 +835,13 @@ namespace ara
              * 
              * \param[in] other     the other instance
              */
-            Result(Result const &other);
+            Result(Result const &other) : mHasValue{true}
+            {
+                if (!other.mHasValue)
+                {
+                    ConstructError(other.mError);
+                }
+            }
 
             // SWS_CORE_00826
             /**
@@ -496,7 +849,13 @@ namespace ara
              * 
              * \param[in] other     the other instance
              */
-            Result(Result &&other) noexcept(std::is_nothrow_move_constructible<E>::value);
+            Result(Result &&other) noexcept(std::is_nothrow_move_constructible<E>::value) : mHasValue{true}
+            {
+                if (!other.mHasValue)
+                {
+                    ConstructError(std::move(other.mError));
+                }
+            }
 
             // SWS_CORE_00827
             /**
@@ -504,7 +863,10 @@ namespace ara
              * 
              * This destructor is trivial if std::is_trivially_destructible<E>::value is true.
              */
-            ~Result();
+            ~Result()
+            {
+                Destroy();
+            }
 
             // SWS_CORE_00831
             /**
@@ -512,7 +874,10 @@ namespace ara
              * 
              * \return Result   a Result that contains a "void" value
              */
-            static Result FromValue();
+            static Result FromValue()
+            {
+                return Result();
+            }
 
             // SWS_CORE_00834
             /**
@@ -521,7 +886,10 @@ namespace ara
              * \param[in] e     the error to put into the Result
              * \return Result   a Result that contains the error e
              */
-            static Result FromError(E const &e);
+            static Result FromError(E const &e)
+            {
+                return Result(e);
+            }
 
             // SWS_CORE_00835
             /**
@@ -530,7 +898,10 @@ namespace ara
              * \param[in] e     the error to put into the Result
              * \return Result   a Result that contains the error e
              */
-            static Result FromError(E const &&e);
+            static Result FromError(E &&e)
+            {
+                return Result(std::move(e));
+            }
 
             // SWS_CORE_00836
             /**
@@ -544,8 +915,14 @@ namespace ara
              * \param[in] args  the parameter pack used for constructing the error
              * \return Result   a Result that contains an error
              */
-            template<typename... Args>
-            static Result FromError(Args& ... args);
+            template<typename... Args, typename = typename std::enable_if<
+                std::is_constructible<E, Args&&...>::value && internal::FirstArgIsNot<E, Args...>::value>::type>
+            static Result FromError(Args &&... args)
+            {
+                Result result;
+                result.ConstructError(std::forward<Args>(args)...);
+                return result;
+            }
 
             // SWS_CORE_00841
             /**
@@ -554,7 +931,21 @@ namespace ara
              * \param[in] other     the other instance
              * \return Result&      *this, containing the contents of other
              */
-            Result& operator=(Result const &other);
+            Result& operator=(Result const &other)
+            {
+                if (this != &other)
+                {
+                    if (other.mHasValue)
+                    {
+                        Destroy();
+                    }
+                    else
+                    {
+                        AssignError(other.mError);
+                    }
+                }
+                return *this;
+            }
 
             // SWS_CORE_00842
             /**
@@ -566,7 +957,21 @@ namespace ara
              * conditionally noexcept
              */
             Result& operator=(Result &&other) noexcept(
-                std::is_nothrow_move_constructible<E>::value && std::is_nothrow_move_assignable<E>::value);
+                std::is_nothrow_move_constructible<E>::value && std::is_nothrow_move_assignable<E>::value)
+            {
+                if (this != &other)
+                {
+                    if (other.mHasValue)
+                    {
+                        Destroy();
+                    }
+                    else
+                    {
+                        AssignError(std::move(other.mError));
+                    }
+                }
+                return *this;
+            }
 
             // SWS_CORE_00843
             /**
@@ -576,7 +981,10 @@ namespace ara
              * \param[in] args  the arguments used for constructing the value
              */
             template<typename... Args>
-            void EmplaceValue(Args &&... args) noexcept;
+            void EmplaceValue(Args &&...) noexcept
+            {
+                Destroy();
+            }
             
             // SWS_CORE_00844
             /**
@@ -586,7 +994,11 @@ namespace ara
              * \param[in] args  the arguments used for constructing the error
              */
             template<typename... Args>
-            void EmplaceError(Args &&... args);
+            void EmplaceError(Args &&... args)
+            {
+                Destroy();
+                ConstructError(std::forward<Args>(args)...);
+            }
 
             // SWS_CORE_00845
             /**
@@ -595,7 +1007,20 @@ namespace ara
              * \param[in] other     the other instance
              */
             void Swap(Result &other) noexcept(
-                std::is_nothrow_move_constructible<E>::value && std::is_nothrow_move_assignable<E>::value);
+                std::is_nothrow_move_constructible<E>::value && std::is_nothrow_move_assignable<E>::value)
+            {
+                using std::swap;
+                if (!mHasValue && !other.mHasValue)
+                {
+                    swap(mError, other.mError);
+                }
+                else if (mHasValue != other.mHasValue)
+                {
+                    Result temporary(std::move(other));
+                    other = std::move(*this);
+                    *this = std::move(temporary);
+                }
+            }
 
             // SWS_CORE_00851
             /**
@@ -604,7 +1029,10 @@ namespace ara
              * \return true     if *this contains a value
              * \return false    otherwise
              */
-            bool HasValue() const noexcept;
+            bool HasValue() const noexcept
+            {
+                return mHasValue;
+            }
 
             // SWS_CORE_00852
             /**
@@ -613,7 +1041,10 @@ namespace ara
              * \return true     if *this contains a value
              * \return false    otherwise
              */
-            explicit operator bool () const noexcept;
+            explicit operator bool () const noexcept
+            {
+                return mHasValue;
+            }
 
             // SWS_CORE_00853
             /**
@@ -621,7 +1052,9 @@ namespace ara
              * This function only exists for helping with generic programming.
              * The behavior of this function is undefined if *this does not contain a value.
              */
-            void operator*() const;
+            void operator*() const
+            {
+            }
 
             // SWS_CORE_00855
             /**
@@ -629,7 +1062,9 @@ namespace ara
              * This function only exists for helping with generic programming.
              * The behavior of this function is undefined if *this does not contain a value.
              */
-            void Value() const;
+            void Value() const
+            {
+            }
 
             // SWS_CORE_00857
             /**
@@ -638,7 +1073,10 @@ namespace ara
              * 
              * \return E const&     a const reference to the contained error
              */
-            E const& Error() const &;
+            E const& Error() const &
+            {
+                return mError;
+            }
 
             // SWS_CORE_00858
             /**
@@ -647,7 +1085,10 @@ namespace ara
              * 
              * \return E&&  an rvalue reference to the contained error
              */
-            E&& Error() &&;
+            E&& Error() &&
+            {
+                return std::move(mError);
+            }
 
             // SWS_CORE_00861
             /**
@@ -658,7 +1099,9 @@ namespace ara
              * \param[in] defaultValue  the value to use if *this does not contain a value
              */
             template<typename U>
-            void ValueOr(U &&defaultValue) const;
+            void ValueOr(U &&) const
+            {
+            }
 
             // SWS_CORE_00863
             /**
@@ -671,7 +1114,10 @@ namespace ara
              * \return E    the error
              */
             template<typename G>
-            E ErrorOr(G &&defaultError) const;
+            E ErrorOr(G &&defaultError) const
+            {
+                return mHasValue ? static_cast<E>(std::forward<G>(defaultError)) : mError;
+            }
 
             // SWS_CORE_00865
             /**
@@ -684,7 +1130,10 @@ namespace ara
              * \return false    otherwise
              */
             template<typename G>
-            bool CheckError(G &&error) const;
+            bool CheckError(G &&error) const
+            {
+                return !mHasValue && (mError == static_cast<E>(std::forward<G>(error)));
+            }
 
             // SWS_CORE_00866
             /**
@@ -694,7 +1143,13 @@ namespace ara
              * 
              * \exception <TYPE>    the exception type associated with the contained error
              */
-            void ValueOrThrow() const noexcept(false);
+            void ValueOrThrow() const noexcept(false)
+            {
+                if (!mHasValue)
+                {
+                    mError.ThrowAsException();
+                }
+            }
 
             // SWS_CORE_00867
             /**
@@ -707,9 +1162,70 @@ namespace ara
              * \param[in] f the Callable
              */
             template<typename F>
-            void Resolve(F &&f) const;
+            void Resolve(F &&f) const
+            {
+                if (!mHasValue)
+                {
+                    std::forward<F>(f)(mError);
+                }
+            }
+
+        private:
+            /**
+             * \brief Constructs the error; no error shall be alive.
+             * 
+             */
+            template <typename... Args>
+            void ConstructError(Args &&... args)
+            {
+                ::new (static_cast<void*>(std::addressof(mError))) E(std::forward<Args>(args)...);
+                mHasValue = false;
+            }
+
+            void Destroy() noexcept
+            {
+                if (!mHasValue)
+                {
+                    mError.~E();
+                }
+                mHasValue = true;
+            }
+
+            template <typename G>
+            void AssignError(G &&error)
+            {
+                if (mHasValue)
+                {
+                    ConstructError(std::forward<G>(error));
+                }
+                else
+                {
+                    mError = std::forward<G>(error);
+                }
+            }
+
+            union
+            {
+                E mError;   /*< The error, alive if !mHasValue. */
+            };
+            bool mHasValue; /*< Whether the Result holds the "void" value. */
         };
 
+        namespace internal
+        {
+            template<typename T, typename E>
+            bool ValuesEqual(Result<T, E> const &lhs, Result<T, E> const &rhs)
+            {
+                return lhs.Value() == rhs.Value();
+            }
+
+            template<typename E>
+            bool ValuesEqual(Result<void, E> const &, Result<void, E> const &)
+            {
+                return true;
+            }
+        } // namespace internal
+
         // SWS_CORE_00780
         /**
          * \brief Compare two Result instances for equality.
@@ -724,7 +1240,14 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(Result<T, E> const &lhs, Result<T, E> const &rhs);
+        bool operator==(Result<T, E> const &lhs, Result<T, E> const &rhs)
+        {
+            if (lhs.HasValue() != rhs.HasValue())
+            {
+                return false;
+            }
+            return lhs.HasValue() ? internal::ValuesEqual(lhs, rhs) : (lhs.Error() == rhs.Error());
+        }
 
         // SWS_CORE_00781
         /**
@@ -740,7 +1263,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(Result<T, E> const &lhs, Result<T, E> const &rhs);
+        bool operator!=(Result<T, E> const &lhs, Result<T, E> const &rhs)
+        {
+            return !(lhs == rhs);
+        }
 
         // SWS_CORE_00782
         /**
@@ -756,7 +1282,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(Result<T, E> const &lhs, T const &rhs);
+        bool operator==(Result<T, E> const &lhs, T const &rhs)
+        {
+            return lhs.HasValue() && (lhs.Value() == rhs);
+        }
 
         // SWS_CORE_00783
         /**
@@ -772,7 +1301,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(T const &lhs, Result<T, E> const &rhs);
+        bool operator==(T const &lhs, Result<T, E> const &rhs)
+        {
+            return rhs.HasValue() && (lhs == rhs.Value());
+        }
 
         // SWS_CORE_00784
         /**
@@ -788,7 +1320,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(Result<T, E> const &lhs, T const &rhs);
+        bool operator!=(Result<T, E> const &lhs, T const &rhs)
+        {
+            return !(lhs == rhs);
+        }
 
         // SWS_CORE_00785
         /**
@@ -804,7 +1339,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(T const &lhs, Result<T, E> const &rhs);]
+        bool operator!=(T const &lhs, Result<T, E> const &rhs)
+        {
+            return !(lhs == rhs);
+        }
         
         // SWS_CORE_00786
         /**
@@ -820,7 +1358,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(Result<T, E> const &lhs, E const &rhs);
+        bool operator==(Result<T, E> const &lhs, E const &rhs)
+        {
+            return !lhs.HasValue() && (lhs.Error() == rhs);
+        }
 
         // SWS_CORE_00787
         /**
@@ -836,7 +1377,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator==(E const &lhs, Result<T, E> const &rhs);
+        bool operator==(E const &lhs, Result<T, E> const &rhs)
+        {
+            return !rhs.HasValue() && (lhs == rhs.Error());
+        }
 
         // SWS_CORE_00788
         /**
@@ -852,7 +1396,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(Result<T, E> const &lhs, E const &rhs);
+        bool operator!=(Result<T, E> const &lhs, E const &rhs)
+        {
+            return !(lhs == rhs);
+        }
 
         // SWS_CORE_00789
         /**
@@ -868,7 +1415,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename T, typename E>
-        bool operator!=(E const &lhs, Result<T, E> const &rhs);
+        bool operator!=(E const &lhs, Result<T, E> const &rhs)
+        {
+            return !(lhs == rhs);
+        }
 
         // SWS_CORE_00796
         /**
@@ -880,9 +1430,10 @@ namespace ara
          * \param[in] rhs   another instance
          */
         template<typename T, typename E>
-        void swap(Result<T, E> &lhs, Result<T, E> &rhs) noexcept(noexcept(lhs.Swap(rhs)));
-
-
+        void swap(Result<T, E> &lhs, Result<T, E> &rhs) noexcept(noexcept(lhs.Swap(rhs)))
+        {
+            lhs.Swap(rhs);
+        }
     } // namespace core
     
 } // namespace ara
@@ -13,6 +13,10 @@
 
 #include <cstddef>
 #include <iterator>
+#include <limits>
+#include <type_traits>
+#include "ara/core/array.h"
+#include "ara/core/utility.h"
 
 namespace ara
 {
@@ -27,6 +31,63 @@ namespace ara
          */
         constexpr std::size_t dynamic_extent = std::numeric_limits<std::size_t>::max();
 
+        template<typename T, std::size_t Extent>
+        class Span;
+
+        namespace internal
+        {
+            template<typename T>
+            struct IsSpan : std::false_type
+            {
+            };
+
+            template<typename T, std::size_t Extent>
+            struct IsSpan<Span<T, Extent>> : std::true_type
+            {
+            };
+
+            template<typename T>
+            struct IsArray : std::false_type
+            {
+            };
+
+            template<typename T, std::size_t N>
+            struct IsArray<Array<T, N>> : std::true_type
+            {
+            };
+
+            /**
+             * \brief Whether a Span<T> can be constructed from a Container, following SWS_CORE_01947.
+             * 
+             */
+            template<typename Container, typename T, typename = void>
+            struct IsCompatibleContainer : std::false_type
+            {
+            };
+
+            template<typename Container, typename T>
+            struct IsCompatibleContainer<Container, T, typename std::enable_if<
+                !IsSpan<typename std::remove_cv<Container>::type>::value &&
+                !IsArray<typename std::remove_cv<Container>::type>::value &&
+                !std::is_array<Container>::value &&
+                std::is_convertible<
+                    typename std::remove_pointer<decltype(ara::core::data(std::declval<Container&>()))>::type(*)[],
+                    T(*)[]>::value,
+                decltype(ara::core::size(std::declval<Container&>()), void())>::type> : std::true_type
+            {
+            };
+
+            /**
+             * \brief The extent of the Span returned by subspan<Offset, Count>(), following SWS_CORE_01965.
+             * 
+             */
+            template<std::size_t Extent, std::size_t Offset, std::size_t Count>
+            struct SubspanExtent : std::integral_constant<std::size_t,
+                Count != dynamic_extent ? Count : (Extent != dynamic_extent ? Extent - Offset : dynamic_extent)>
+            {
+            };
+        } // namespace internal
+
         // SWS_CORE_01900
         /**
          * \brief A view over a contiguous sequence of objects.
@@ -37,6 +98,7 @@ namespace ara
         template<typename T, std::size_t Extent = dynamic_extent>
         class Span
         {
+        public:
             // SWS_CORE_01911
             /**
              * \brief Alias for the type of elements in this Span.
@@ -95,7 +157,7 @@ namespace ara
              * ConstexprIterator.
              * 
              */
-            using iterator = implementation_defined;
+            using iterator = element_type*;
 
             // SWS_CORE_01918
             /**
@@ -105,7 +167,7 @@ namespace ara
              * ConstexprIterator.
              * 
              */
-            using const_iterator = implementation_defined;
+            using const_iterator = element_type const*;
 
             // SWS_CORE_01919
             /**
@@ -119,14 +181,14 @@ namespace ara
              * \brief The type of a const_reverse_iterator to elements.
              * 
              */
-            using const_reverse_iterator = std_reverse_iterator<const_iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
             // SWS_CORE_01931
             /**
              * \brief A constant reflecting the configured Extent of this Span.
              * 
              */
-            constexpr index_type extent = Extent;
+            static constexpr index_type extent = Extent;
 
             // SWS_CORE_01941
             /**
@@ -134,7 +196,10 @@ namespace ara
              * This constructor shall not participate in overload resolution unless Extent <= 0 is true.
              * 
              */
-            constexpr Span() noexcept;
+            template<std::size_t E = Extent, typename = typename std::enable_if<E == dynamic_extent || E == 0U>::type>
+            constexpr Span() noexcept : mData{nullptr}, mSize{0U}
+            {
+            }
 
             // SWS_CORE_01942
             /**
@@ -146,7 +211,9 @@ namespace ara
              * \param[in] ptr   the pointer
              * \param[in] count the number of elements to take from ptr
              */
-            constexpr Span(pointer ptr, index_type count);
+            constexpr Span(pointer ptr, index_type count) : mData{ptr}, mSize{count}
+            {
+            }
 
             // SWS_CORE_01943
             /**
@@ -158,7 +225,9 @@ namespace ara
              * \param[in] firstElem pointer to the first element 
              * \param[in] lastElem  pointer to past the last element
              */
-            constexpr Span(pointer firstElem, pointer lastElem);
+            constexpr Span(pointer firstElem, pointer lastElem) : mData{firstElem}, mSize{static_cast<index_type>(lastElem - firstElem)}
+            {
+            }
 
             // SWS_CORE_01944
             /**
@@ -171,8 +240,10 @@ namespace ara
              * 
              * \param[in] arr   the raw array
              */
-            template<std::size_t N>
-            constexpr Span(element_type(&arr)[N]) noexcept;
+            template<std::size_t N, typename = typename std::enable_if<Extent == dynamic_extent || N == Extent>::type>
+            constexpr Span(element_type(&arr)[N]) noexcept : mData{arr}, mSize{N}
+            {
+            }
 
             // SWS_CORE_01945
             /**
@@ -184,8 +255,11 @@ namespace ara
              * \tparam N the size of the Array
              * \param[in] arr   the array
              */
-            template<std::size_t N>
-            constexpr Span(Array<value_type, N> &arr) noexcept;
+            template<std::size_t N, typename = typename std::enable_if<
+                (Extent == dynamic_extent || N == Extent) && std::is_convertible<value_type(*)[], T(*)[]>::value>::type>
+            constexpr Span(Array<value_type, N> &arr) noexcept : mData{arr.data()}, mSize{N}
+            {
+            }
 
             // SWS_CORE_01946
             /**
@@ -197,8 +271,11 @@ namespace ara
              * \tparam N the size of the Array
              * \param[in] arr   the array
              */
-            template<std::size_t N>
-            constexpr Span(Array<value_type, N> const &arr) noexcept;
+            template<std::size_t N, typename = typename std::enable_if<
+                (Extent == dynamic_extent || N == Extent) && std::is_convertible<value_type const(*)[], T(*)[]>::value>::type>
+            constexpr Span(Array<value_type, N> const &arr) noexcept : mData{arr.data()}, mSize{N}
+            {
+            }
 
             // SWS_CORE_01947
             /**
@@ -215,8 +292,10 @@ namespace ara
              * 
              * \param[in] cont  the container
              */
-            template<typename Container>
-            constexpr Span(Container &cont);
+            template<typename Container, typename = typename std::enable_if<internal::IsCompatibleContainer<Container, T>::value>::type>
+            constexpr Span(Container &cont) : mData{ara::core::data(cont)}, mSize{static_cast<index_type>(ara::core::size(cont))}
+            {
+            }
 
             // SWS_CORE_01948
             /**
@@ -234,8 +313,10 @@ namespace ara
              * \tparam Container the type of container
              * \param[in] cont  the container
              */
-            template<typename Container>
-            constexpr Span(Container const &cont);
+            template<typename Container, typename = typename std::enable_if<internal::IsCompatibleContainer<Container const, T>::value>::type>
+            constexpr Span(Container const &cont) : mData{ara::core::data(cont)}, mSize{static_cast<index_type>(ara::core::size(cont))}
+            {
+            }
 
             // SWS_CORE_01949
             /**
@@ -257,8 +338,11 @@ namespace ara
              * 
              * \param[in] s the other Span instance
              */
-            template<typename U, std::size_t N>
-            constexpr Span(Span<U, N> const &s) noexcept;
+            template<typename U, std::size_t N, typename = typename std::enable_if<
+                (Extent == dynamic_extent || N == Extent) && std::is_convertible<U(*)[], T(*)[]>::value>::type>
+            constexpr Span(Span<U, N> const &s) noexcept : mData{s.data()}, mSize{s.size()}
+            {
+            }
 
             // SWS_CORE_01951
             /**
@@ -284,7 +368,10 @@ namespace ara
              * \return Span<element_type, Count>  the subspan
              */
             template<std::size_t Count>
-            constexpr Span<element_type, Count> first() const;
+            constexpr Span<element_type, Count> first() const
+            {
+                return Span<element_type, Count>(mData, Count);
+            }
 
             // SWS_CORE_01962
             /**
@@ -293,7 +380,10 @@ namespace ara
              * \param[in] count     the number of elements to take over
              * \return Span<element_type, dynamic_extent>     the subspan
              */
-            constexpr Span<element_type, dynamic_extent> first(index_type count) const;
+            constexpr Span<element_type, dynamic_extent> first(index_type count) const
+            {
+                return Span<element_type, dynamic_extent>(mData, count);
+            }
 
             // SWS_CORE_01963
             /**
@@ -303,7 +393,10 @@ namespace ara
              * \return Span<element_type, Count>  the subspan
              */
             template<std::size_t Count>
-            constexpr Span<element_type, Count> last() const;
+            constexpr Span<element_type, Count> last() const
+            {
+                return Span<element_type, Count>(mData + (mSize - Count), Count);
+            }
 
             // SWS_CORE_01964
             /**
@@ -312,7 +405,10 @@ namespace ara
              * \param[in] count the number of elements to take over
              * \return Span<element_type, dynamic_extent> 
              */
-            constexpr Span<element_type, dynamic_extent> last(index_type count) const;
+            constexpr Span<element_type, dynamic_extent> last(index_type count) const
+            {
+                return Span<element_type, dynamic_extent>(mData + (mSize - count), count);
+            }
 
             // SWS_CORE_01965
             /**
@@ -327,7 +423,11 @@ namespace ara
              * \return Span<element_type, SEE_BELOW>    the subspan
              */
             template<std::size_t Offset, std::size_t Count = dynamic_extent>
-            constexpr auto subspan() const -> Span<element_type, SEE_BELOW>;
+            constexpr auto subspan() const -> Span<element_type, internal::SubspanExtent<Extent, Offset, Count>::value>
+            {
+                return Span<element_type, internal::SubspanExtent<Extent, Offset, Count>::value>(
+                    mData + Offset, Count != dynamic_extent ? Count : mSize - Offset);
+            }
 
             // SWS_CORE_01966
             /**
@@ -337,7 +437,10 @@ namespace ara
              * \param[in] count     the number of elements to take over
              * \return Span<element_type, dynamic_extent>     the subspan
              */
-            constexpr Span<element_type, dynamic_extent> subspan(index_type offset, index_type count=dynamic_extent) const;
+            constexpr Span<element_type, dynamic_extent> subspan(index_type offset, index_type count=dynamic_extent) const
+            {
+                return Span<element_type, dynamic_extent>(mData + offset, count != dynamic_extent ? count : mSize - offset);
+            }
 
             // SWS_CORE_01967
             /**
@@ -345,7 +448,10 @@ namespace ara
              * 
              * \return index_type     the number of elements contained in this Span
              */
-            constexpr index_type size() const noexcept;
+            constexpr index_type size() const noexcept
+            {
+                return mSize;
+            }
 
             // SWS_CORE_01968
             /**
@@ -353,7 +459,10 @@ namespace ara
              * 
              * \return index_type     the number of bytes covered by this Span
              */
-            constexpr index_type size_bytes() const noexcept;
+            constexpr index_type size_bytes() const noexcept
+            {
+                return mSize * sizeof(element_type);
+            }
 
             // SWS_CORE_01969
             /**
@@ -362,7 +471,10 @@ namespace ara
              * \return true     if this Span contains 0 elements
              * \return false    otherwise
              */
-            constexpr bool empty() const noexcept;
+            constexpr bool empty() const noexcept
+            {
+                return mSize == 0U;
+            }
 
             // SWS_CORE_01970
             /**
@@ -371,7 +483,10 @@ namespace ara
              * \param[in] idx   the index into this Span
              * \return reference  the reference
              */
-            constexpr reference operator[](index_type idx) const;
+            constexpr reference operator[](index_type idx) const
+            {
+                return mData[idx];
+            }
 
             // SWS_CORE_01971
             /**
@@ -379,7 +494,10 @@ namespace ara
              * 
              * \return pointer    the pointer
              */
-            constexpr pointer data() const noexcept;
+            constexpr pointer data() const noexcept
+            {
+                return mData;
+            }
 
             // SWS_CORE_01972
             /**
@@ -387,7 +505,10 @@ namespace ara
              * 
              * \return iterator   the iterator
              */
-            constexpr iterator begin() const noexcept;
+            constexpr iterator begin() const noexcept
+            {
+                return mData;
+            }
 
             // SWS_CORE_01973
             /**
@@ -395,7 +516,10 @@ namespace ara
              * 
              * \return iterator   the iterator
              */
-            constexpr iterator end() const noexcept;
+            constexpr iterator end() const noexcept
+            {
+                return mData + mSize;
+            }
 
             // SWS_CORE_01974
             /**
@@ -403,7 +527,10 @@ namespace ara
              * 
              * \return const_iterator     the const_iterator
              */
-            constexpr const_iterator cbegin() const noexcept;
+            constexpr const_iterator cbegin() const noexcept
+            {
+                return mData;
+            }
 
             // SWS_CORE_01975
             /**
@@ -411,7 +538,10 @@ namespace ara
              * 
              * \return const_iterator   the const_iterator
              */
-            constexpr const_iterator cend() const noexcept;
+            constexpr const_iterator cend() const noexcept
+            {
+                return mData + mSize;
+            }
 
             // SWS_CORE_01976
             /**
@@ -419,7 +549,10 @@ namespace ara
              * 
              * \return reverse_iterator     the reverse_iterator
              */
-            constexpr reverse_iterator rbegin() const noexcept;
+            constexpr reverse_iterator rbegin() const noexcept
+            {
+                return reverse_iterator(end());
+            }
 
             // SWS_CORE_01977
             /**
@@ -427,7 +560,10 @@ namespace ara
              * 
              * \return reverse_iterator     the reverse_iterator
              */
-            constexpr reverse_iterator rend() const noexcept;
+            constexpr reverse_iterator rend() const noexcept
+            {
+                return reverse_iterator(begin());
+            }
 
             // SWS_CORE_01978
             /**
@@ -435,7 +571,10 @@ namespace ara
              * 
              * \return const_reverse_iterator     the const_reverse_iterator
              */
-            constexpr const_reverse_iterator crbegin() const noexcept;
+            constexpr const_reverse_iterator crbegin() const noexcept
+            {
+                return const_reverse_iterator(cend());
+            }
 
             // SWS_CORE_01979
             /**
@@ -443,12 +582,22 @@ namespace ara
              * 
              * \return const_reverse_iterator   the reverse_iterator
              */
-            constexpr const_reverse_iterator crend() const noexcept;
+            constexpr const_reverse_iterator crend() const noexcept
+            {
+                return const_reverse_iterator(cbegin());
+            }
+
+        private:
+            pointer mData;      /*< The first element. */
+            index_type mSize;   /*< The number of elements. */
         };
 
+        template<typename T, std::size_t Extent>
+        constexpr typename Span<T, Extent>::index_type Span<T, Extent>::extent;
+
         // SWS_CORE_01990
         /**
-         * \brief 
+         * \brief Create a new Span from the given pointer and size.
          * 
          * \tparam T    the type of elements
          * 
@@ -458,7 +607,10 @@ namespace ara
          * \return Span<T>  the new Span
          */
         template<typename T>
-        constexpr Span<T> MakeSpan(T *ptr, typename Span<T>::index_type count);
+        constexpr Span<T> MakeSpan(T *ptr, typename Span<T>::index_type count)
+        {
+            return Span<T>(ptr, count);
+        }
 
         // SWS_CORE_01991
         /**
@@ -470,7 +622,10 @@ namespace ara
          * \return Span<T>  the new Span
          */
         template<typename T>
-        constexpr Span<T> MakeSpan(T *firstElem, T *lastElem);
+        constexpr Span<T> MakeSpan(T *firstElem, T *lastElem)
+        {
+            return Span<T>(firstElem, lastElem);
+        }
 
         // SWS_CORE_01992
         /**
@@ -484,7 +639,10 @@ namespace ara
          * \return Span<T, N>   the new Span
          */
         template<typename T, std::size_t N>
-        constexpr Span<T, N> MakeSpan(T(&arr)[N]) noexcept;
+        constexpr Span<T, N> MakeSpan(T(&arr)[N]) noexcept
+        {
+            return Span<T, N>(arr);
+        }
 
         // SWS_CORE_01993
         /**
@@ -495,7 +653,10 @@ namespace ara
          * \return Span<typename Container::value_type>     the new Span
          */
         template<typename Container>
-        constexpr Span<typename Container::value_type> MakeSpan(Container &cont);
+        constexpr Span<typename Container::value_type> MakeSpan(Container &cont)
+        {
+            return Span<typename Container::value_type>(cont);
+        }
 
         // SWS_CORE_01994
         /**
@@ -506,8 +667,10 @@ namespace ara
          * \return Span<typename Container::value_type const>   the new Span
          */
         template<typename Container>
-        constexpr Span<typename Container::value_type const> MakeSpan(Container const &cont);
-
+        constexpr Span<typename Container::value_type const> MakeSpan(Container const &cont)
+        {
+            return Span<typename Container::value_type const>(cont);
+        }
     } // namespace core
     
 } // namespace ara
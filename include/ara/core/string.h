@@ -0,0 +1,41 @@
+/**
+ * \file string.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_CORE_STRING_H_
+#define ARA_CORE_STRING_H_
+
+#include <memory>
+#include <string>
+
+namespace ara
+{
+    namespace core
+    {
+        // SWS_CORE_03000
+        /**
+         * \brief A sequence of characters with a customizable allocator.
+         * 
+         * \tparam Allocator    the type of Allocator to use for this container
+         */
+        template <typename Allocator = std::allocator<char>>
+        using BasicString = std::basic_string<char, std::char_traits<char>, Allocator>;
+
+        // SWS_CORE_03001
+        /**
+         * \brief A BasicString using the default allocator.
+         * 
+         */
+        using String = BasicString<>;
+    } // namespace core
+    
+} // namespace ara
+
+
+#endif // ARA_CORE_STRING_H_
@@ -0,0 +1,399 @@
+/**
+ * \file string_view.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_CORE_STRING_VIEW_H_
+#define ARA_CORE_STRING_VIEW_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace ara
+{
+    namespace core
+    {
+        /**
+         * \brief A read-only view over a contiguous sequence of characters, in the manner of C++17
+         *        std::basic_string_view.
+         * 
+         * The view does not own the characters; they shall outlive it. Unlike std::basic_string_view, a
+         * BasicStringView can be constructed implicitly from a std::basic_string, since the latter has no
+         * conversion operator to it.
+         * 
+         * \tparam CharT    the character type
+         * \tparam Traits   the character traits
+         */
+        template <typename CharT, typename Traits = std::char_traits<CharT>>
+        class BasicStringView final
+        {
+        public:
+            using traits_type = Traits;
+            using value_type = CharT;
+            using pointer = CharT*;
+            using const_pointer = CharT const*;
+            using reference = CharT&;
+            using const_reference = CharT const&;
+            using const_iterator = CharT const*;
+            using iterator = const_iterator;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+            using reverse_iterator = const_reverse_iterator;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+
+            /**
+             * \brief Special value for "until the end" and "not found".
+             * 
+             */
+            static constexpr size_type npos = static_cast<size_type>(-1);
+
+            /**
+             * \brief Constructs an empty view.
+             * 
+             */
+            constexpr BasicStringView() noexcept : mData{nullptr}, mSize{0U}
+            {
+            }
+
+            /**
+             * \brief Constructs a view of the first count characters of s.
+             * 
+             * \param[in] s         the characters
+             * \param[in] count     the number of characters
+             */
+            constexpr BasicStringView(const_pointer s, size_type count) noexcept : mData{s}, mSize{count}
+            {
+            }
+
+            /**
+             * \brief Constructs a view of the null-terminated string s, excluding the terminator.
+             * 
+             * \param[in] s     the null-terminated string
+             */
+            BasicStringView(const_pointer s) noexcept : mData{s}, mSize{Traits::length(s)}
+            {
+            }
+
+            /**
+             * \brief Constructs a view of the characters of s.
+             * 
+             * \param[in] s     the string, which shall not be modified while the view is used
+             */
+            template <typename Allocator>
+            BasicStringView(std::basic_string<CharT, Traits, Allocator> const &s) noexcept : mData{s.data()}, mSize{s.size()}
+            {
+            }
+
+            constexpr BasicStringView(BasicStringView const &) noexcept = default;
+
+            BasicStringView& operator=(BasicStringView const &) noexcept = default;
+
+            constexpr const_iterator begin() const noexcept
+            {
+                return mData;
+            }
+
+            constexpr const_iterator end() const noexcept
+            {
+                return mData + mSize;
+            }
+
+            constexpr const_iterator cbegin() const noexcept
+            {
+                return begin();
+            }
+
+            constexpr const_iterator cend() const noexcept
+            {
+                return end();
+            }
+
+            const_reverse_iterator rbegin() const noexcept
+            {
+                return const_reverse_iterator(end());
+            }
+
+            const_reverse_iterator rend() const noexcept
+            {
+                return const_reverse_iterator(begin());
+            }
+
+            constexpr size_type size() const noexcept
+            {
+                return mSize;
+            }
+
+            constexpr size_type length() const noexcept
+            {
+                return mSize;
+            }
+
+            constexpr size_type max_size() const noexcept
+            {
+                return static_cast<size_type>(-1) / sizeof(CharT);
+            }
+
+            constexpr bool empty() const noexcept
+            {
+                return mSize == 0U;
+            }
+
+            /**
+             * \brief Returns the character at pos, which shall be less than size().
+             * 
+             */
+            constexpr const_reference operator[](size_type pos) const noexcept
+            {
+                return mData[pos];
+            }
+
+            /**
+             * \brief Returns the character at pos.
+             * 
+             * \param[in] pos   the position
+             * \return const_reference  the character
+             * \throws std::out_of_range    if pos >= size()
+             */
+            const_reference at(size_type pos) const
+            {
+                if (pos >= mSize)
+                {
+                    throw std::out_of_range("BasicStringView::at");
+                }
+                return mData[pos];
+            }
+
+            constexpr const_reference front() const noexcept
+            {
+                return mData[0U];
+            }
+
+            constexpr const_reference back() const noexcept
+            {
+                return mData[mSize - 1U];
+            }
+
+            /**
+             * \brief Returns the characters, which are not necessarily null-terminated.
+             * 
+             */
+            constexpr const_pointer data() const noexcept
+            {
+                return mData;
+            }
+
+            void remove_prefix(size_type n) noexcept
+            {
+                mData += n;
+                mSize -= n;
+            }
+
+            void remove_suffix(size_type n) noexcept
+            {
+                mSize -= n;
+            }
+
+            void swap(BasicStringView &other) noexcept
+            {
+                std::swap(mData, other.mData);
+                std::swap(mSize, other.mSize);
+            }
+
+            /**
+             * \brief Copies at most count characters, starting at pos, to dest.
+             * 
+             * \return size_type    the number of copied characters
+             * \throws std::out_of_range    if pos > size()
+             */
+            size_type copy(CharT *dest, size_type count, size_type pos = 0U) const
+            {
+                if (pos > mSize)
+                {
+                    throw std::out_of_range("BasicStringView::copy");
+                }
+                size_type const n = std::min(count, mSize - pos);
+                Traits::copy(dest, mData + pos, n);
+                return n;
+            }
+
+            /**
+             * \brief Returns the view of at most count characters starting at pos.
+             * 
+             * \throws std::out_of_range    if pos > size()
+             */
+            BasicStringView substr(size_type pos = 0U, size_type count = npos) const
+            {
+                if (pos > mSize)
+                {
+                    throw std::out_of_range("BasicStringView::substr");
+                }
+                return BasicStringView(mData + pos, std::min(count, mSize - pos));
+            }
+
+            /**
+             * \brief Compares lexicographically with other.
+             * 
+             * \return int  a negative value, zero or a positive value if *this is less than, equal to or
+             *              greater than other
+             */
+            int compare(BasicStringView other) const noexcept
+            {
+                int const result = Traits::compare(mData, other.mData, std::min(mSize, other.mSize));
+                if (result != 0)
+                {
+                    return result;
+                }
+                return (mSize == other.mSize) ? 0 : ((mSize < other.mSize) ? -1 : 1);
+            }
+
+            bool starts_with(BasicStringView prefix) const noexcept
+            {
+                return (mSize >= prefix.mSize) && (Traits::compare(mData, prefix.mData, prefix.mSize) == 0);
+            }
+
+            bool ends_with(BasicStringView suffix) const noexcept
+            {
+                return (mSize >= suffix.mSize) && (Traits::compare(mData + (mSize - suffix.mSize), suffix.mData, suffix.mSize) == 0);
+            }
+
+            /**
+             * \brief Finds the first occurrence of s at or after pos.
+             * 
+             * \return size_type    the position of the occurrence, or npos
+             */
+            size_type find(BasicStringView s, size_type pos = 0U) const noexcept
+            {
+                if ((pos > mSize) || (s.mSize > mSize - pos))
+                {
+                    return npos;
+                }
+                for (size_type i = pos; i + s.mSize <= mSize; ++i)
+                {
+                    if (Traits::compare(mData + i, s.mData, s.mSize) == 0)
+                    {
+                        return i;
+                    }
+                }
+                return npos;
+            }
+
+            /**
+             * \brief Finds the first occurrence of c at or after pos.
+             * 
+             * \return size_type    the position of the occurrence, or npos
+             */
+            size_type find(CharT c, size_type pos = 0U) const noexcept
+            {
+                if (pos >= mSize)
+                {
+                    return npos;
+                }
+                CharT const *found = Traits::find(mData + pos, mSize - pos, c);
+                return (found != nullptr) ? static_cast<size_type>(found - mData) : npos;
+            }
+
+            /**
+             * \brief Finds the last occurrence of c at or before pos.
+             * 
+             * \return size_type    the position of the occurrence, or npos
+             */
+            size_type rfind(CharT c, size_type pos = npos) const noexcept
+            {
+                if (mSize == 0U)
+                {
+                    return npos;
+                }
+                for (size_type i = std::min(pos, mSize - 1U) + 1U; i > 0U; --i)
+                {
+                    if (Traits::eq(mData[i - 1U], c))
+                    {
+                        return i - 1U;
+                    }
+                }
+                return npos;
+            }
+
+        private:
+            const_pointer mData;    /*< The first character. */
+            size_type mSize;        /*< The number of characters. */
+        };
+
+        template <typename CharT, typename Traits>
+        constexpr typename BasicStringView<CharT, Traits>::size_type BasicStringView<CharT, Traits>::npos;
+
+        // SWS_CORE_02001
+        /**
+         * \brief A read-only view over a contiguous sequence of characters.
+         * 
+         */
+        using StringView = BasicStringView<char>;
+
+        template <typename CharT, typename Traits>
+        bool operator==(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+        {
+            return (lhs.size() == rhs.size()) && (lhs.compare(rhs) == 0);
+        }
+
+        template <typename CharT, typename Traits>
+        bool operator!=(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        template <typename CharT, typename Traits>
+        bool operator<(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+        {
+            return lhs.compare(rhs) < 0;
+        }
+
+        template <typename CharT, typename Traits>
+        bool operator>(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+        {
+            return rhs < lhs;
+        }
+
+        template <typename CharT, typename Traits>
+        bool operator<=(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+        {
+            return !(rhs < lhs);
+        }
+
+        template <typename CharT, typename Traits>
+        bool operator>=(BasicStringView<CharT, Traits> lhs, BasicStringView<CharT, Traits> rhs) noexcept
+        {
+            return !(lhs < rhs);
+        }
+
+        /**
+         * \brief Comparisons between a StringView and anything convertible to it, e.g. a string literal or
+         *        a String; these have to be spelled out since templates do not deduce through conversions.
+         * 
+         */
+        inline bool operator==(StringView lhs, StringView rhs) noexcept
+        {
+            return (lhs.size() == rhs.size()) && (lhs.compare(rhs) == 0);
+        }
+
+        inline bool operator!=(StringView lhs, StringView rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        inline bool operator<(StringView lhs, StringView rhs) noexcept
+        {
+            return lhs.compare(rhs) < 0;
+        }
+    } // namespace core
+    
+} // namespace ara
+
+
+#endif // ARA_CORE_STRING_VIEW_H_
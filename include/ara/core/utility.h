@@ -12,6 +12,7 @@
 #define ARA_CORE_UTILITY_H_
 
 #include <cstddef>
+#include <initializer_list>
 
 namespace ara
 {
@@ -21,8 +22,13 @@ namespace ara
         /**
          * \brief A non-integral binary type.
          * 
+         * Like std::byte of C++17, it has the size and alignment of unsigned char, supports no arithmetic, and
+         * converts to and from integers only by static_cast.
+         * 
          */
-        using Byte = IMPEMENTATION_DEFINED;
+        enum class Byte : unsigned char
+        {
+        };
 
         // SWS_CORE_04011
         /**
@@ -48,7 +54,7 @@ namespace ara
          * \brief The singleton instance of in_place_t.
          * 
          */
-        constexpr in_place_t in_place;
+        constexpr in_place_t in_place{};
 
         // SWS_CORE_04021
         /**
@@ -61,16 +67,25 @@ namespace ara
          * \tparam T 
          */
         template<typename T>
-        struct inplace_type_t
+        struct in_place_type_t
         {
             // SWS_CORE_04022
             /**
              * \brief Default constructor.
              * 
              */
-            explicit inplace_type_t() = default;
+            explicit in_place_type_t() = default;
         };
 
+        // SWS_CORE_04023
+        /**
+         * \brief The singleton instances (one for each T) of in_place_type_t.
+         * 
+         * \tparam T    the type to address
+         */
+        template<typename T>
+        constexpr in_place_type_t<T> in_place_type{};
+
         // SWS_CORE_04031
         /**
          * \brief Denote an index-distinguishing operation to be performed in-place.
@@ -81,7 +96,7 @@ namespace ara
          * 
          * \tparam I  -
          */
-        template<size_t I>
+        template<std::size_t I>
         struct in_place_index_t
         {
             // SWS_CORE_04032
@@ -92,6 +107,14 @@ namespace ara
             explicit in_place_index_t() = default;
         };
 
+        // SWS_CORE_04033
+        /**
+         * \brief The singleton instances (one for each I) of in_place_index_t.
+         * 
+         * \tparam I    the index to address
+         */
+        template<std::size_t I>
+        constexpr in_place_index_t<I> in_place_index{};
 
         // SWS_CORE_04110
         /**
@@ -102,7 +125,10 @@ namespace ara
          * \return decltype(c.data())   a pointer to the first element of the container
          */
         template<typename Container>
-        constexpr auto data(Container &c) -> decltype(c.data());
+        constexpr auto data(Container &c) -> decltype(c.data())
+        {
+            return c.data();
+        }
 
         // SWS_CORE_04111
         /**
@@ -113,7 +139,10 @@ namespace ara
          * \return decltype(c.data())   a pointer to the first element of the container
          */
         template<typename Container>
-        constexpr auto data(Container const &c) -> decltype(c.data());
+        constexpr auto data(Container const &c) -> decltype(c.data())
+        {
+            return c.data();
+        }
 
         // SWS_CORE_04112
         /**
@@ -127,7 +156,10 @@ namespace ara
          * \return T* a pointer to the first element of the array
          */
         template<typename T, std::size_t N>
-        constexpr T* data(T(&array)[N]) noexcept;
+        constexpr T* data(T(&array)[N]) noexcept
+        {
+            return array;
+        }
         
         // SWS_CORE_04113
         /**
@@ -138,7 +170,10 @@ namespace ara
          * \return E const* a pointer to the first element of the std::initializer_list
          */
         template<typename E>
-        constexpr E const* data(std::initializer_list<E> il) noexcept;
+        constexpr E const* data(std::initializer_list<E> il) noexcept
+        {
+            return il.begin();
+        }
 
         // SWS_CORE_04120
         /**
@@ -149,7 +184,10 @@ namespace ara
          * \return decltype(c.size())   the size of the container
          */
         template<typename Container>
-        constexpr auto size(Container const &c) -> decltype(c.size());
+        constexpr auto size(Container const &c) -> decltype(c.size())
+        {
+            return c.size();
+        }
 
         // SWS_CORE_04121
         /**
@@ -163,7 +201,11 @@ namespace ara
          * \return std::size_t  the size of the array, i.e. N
          */
         template<typename T, std::size_t N>
-        constexpr std::size_t size(T const (&array)[N]) noexcept;
+        constexpr std::size_t size(T const (&array)[N]) noexcept
+        {
+            static_cast<void>(array);
+            return N;
+        }
 
         // SWS_CORE_04130
         /**
@@ -174,7 +216,10 @@ namespace ara
          * \return decltype(c.empty())  true if the container is empty, false otherwise
          */
         template<typename Container>
-        constexpr auto empty(Container const &c) -> decltype(c.empty());
+        constexpr auto empty(Container const &c) -> decltype(c.empty())
+        {
+            return c.empty();
+        }
 
         // SWS_CORE_04131
         /**
@@ -191,7 +236,11 @@ namespace ara
          * \return false    false
          */
         template<typename T, std::size_t N>
-        constexpr bool empty(T const (&array)[N]) constexpr;
+        constexpr bool empty(T const (&array)[N]) noexcept
+        {
+            static_cast<void>(array);
+            return false;
+        }
 
         // SWS_CORE_04132
         /**
@@ -203,7 +252,10 @@ namespace ara
          * \return false    otherwise
          */
         template<typename E>
-        constexpr bool empty(std::initializer_list<E> il) noexcept;
+        constexpr bool empty(std::initializer_list<E> il) noexcept
+        {
+            return il.size() == 0U;
+        }
     } // namespace core
     
 } // namespace ara
@@ -0,0 +1,800 @@
+/**
+ * \file variant.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_CORE_VARIANT_H_
+#define ARA_CORE_VARIANT_H_
+
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "ara/core/utility.h"
+
+namespace ara
+{
+    namespace core
+    {
+        template <typename... Ts>
+        class Variant;
+
+        /**
+         * \brief The index() of a Variant which holds no value because the construction of its alternative
+         *        threw.
+         * 
+         */
+        constexpr std::size_t variant_npos = std::numeric_limits<std::size_t>::max();
+
+        /**
+         * \brief An empty alternative, which makes a Variant default-constructible.
+         * 
+         */
+        struct monostate
+        {
+        };
+
+        /**
+         * \brief Compares two monostates; they are always equal.
+         * 
+         */
+        constexpr bool operator==(monostate, monostate) noexcept
+        {
+            return true;
+        }
+
+        /**
+         * \brief Compares two monostates; they are never different.
+         * 
+         */
+        constexpr bool operator!=(monostate, monostate) noexcept
+        {
+            return false;
+        }
+
+        /**
+         * \brief Orders two monostates; neither is less than the other.
+         * 
+         */
+        constexpr bool operator<(monostate, monostate) noexcept
+        {
+            return false;
+        }
+
+        /**
+         * \brief The number of alternatives of a Variant.
+         * 
+         * \tparam V    the Variant
+         */
+        template <typename V>
+        struct variant_size;
+
+        template <typename... Ts>
+        struct variant_size<Variant<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)>
+        {
+        };
+
+        template <typename V>
+        struct variant_size<V const> : variant_size<V>
+        {
+        };
+
+        /**
+         * \brief The type of an alternative of a Variant.
+         * 
+         * \tparam I    the index of the alternative
+         * \tparam V    the Variant
+         */
+        template <std::size_t I, typename V>
+        struct variant_alternative;
+
+        template <std::size_t I, typename... Ts>
+        struct variant_alternative<I, Variant<Ts...>>
+        {
+            static_assert(I < sizeof...(Ts), "Variant alternative index out of range");
+            using type = typename std::tuple_element<I, std::tuple<Ts...>>::type;
+        };
+
+        template <std::size_t I, typename V>
+        struct variant_alternative<I, V const>
+        {
+            using type = typename variant_alternative<I, V>::type const;
+        };
+
+        template <std::size_t I, typename V>
+        using variant_alternative_t = typename variant_alternative<I, V>::type;
+
+        namespace internal
+        {
+            constexpr std::size_t MaxOf(std::initializer_list<std::size_t> values) noexcept
+            {
+                std::size_t result = 0U;
+                for (std::size_t value : values)
+                {
+                    result = (value > result) ? value : result;
+                }
+                return result;
+            }
+
+            /**
+             * \brief Index of T among Ts, or sizeof...(Ts) if T is not exactly one of them.
+             * 
+             */
+            template <typename T, typename... Ts>
+            struct UniqueIndexOf;
+
+            template <typename T>
+            struct UniqueIndexOf<T>
+            {
+                static constexpr std::size_t kCount = 0U;
+                static constexpr std::size_t kIndex = 0U;
+                static constexpr std::size_t value = 0U;
+            };
+
+            template <typename T, typename Head, typename... Tail>
+            struct UniqueIndexOf<T, Head, Tail...>
+            {
+                static constexpr std::size_t kCount = (std::is_same<T, Head>::value ? 1U : 0U) + UniqueIndexOf<T, Tail...>::kCount;
+                static constexpr std::size_t kIndex = std::is_same<T, Head>::value ? 0U : 1U + UniqueIndexOf<T, Tail...>::kIndex;
+                static constexpr std::size_t value = (kCount == 1U) ? kIndex : sizeof...(Tail) + 1U;
+            };
+
+            constexpr bool AllOf(std::initializer_list<bool> values) noexcept
+            {
+                for (bool value : values)
+                {
+                    if (!value)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            template <typename... Ts>
+            struct AllNothrowMoveConstructible : std::integral_constant<bool, AllOf({std::is_nothrow_move_constructible<Ts>::value...})>
+            {
+            };
+
+            template <typename... Ts>
+            struct AllNothrowMoveAssignable : std::integral_constant<bool, AllOf({std::is_nothrow_move_assignable<Ts>::value...})>
+            {
+            };
+
+            /**
+             * \brief Overload set with one function per alternative, to select the alternative which the
+             *        converting constructor of Variant constructs.
+             * 
+             */
+            template <std::size_t I, typename... Ts>
+            struct Selector
+            {
+                static void Select();
+            };
+
+            template <std::size_t I, typename T, typename... Ts>
+            struct Selector<I, T, Ts...> : Selector<I + 1U, Ts...>
+            {
+                using Selector<I + 1U, Ts...>::Select;
+                static std::integral_constant<std::size_t, I> Select(T);
+            };
+
+            template <typename U, typename... Ts>
+            using SelectedIndex = decltype(Selector<0U, Ts...>::Select(std::declval<U>()));
+
+            /**
+             * \brief Operations on the storage of a Variant, one function per alternative, dispatched through
+             *        tables built at compile time.
+             * 
+             */
+            template <typename... Ts>
+            struct VariantOps
+            {
+                template <typename T>
+                static void Destroy(void *storage) noexcept
+                {
+                    static_cast<T*>(storage)->~T();
+                }
+
+                template <typename T>
+                static void CopyConstruct(void *storage, void const *other)
+                {
+                    ::new (storage) T(*static_cast<T const*>(other));
+                }
+
+                template <typename T>
+                static void MoveConstruct(void *storage, void *other)
+                {
+                    ::new (storage) T(std::move(*static_cast<T*>(other)));
+                }
+
+                template <typename T>
+                static void CopyAssign(void *storage, void const *other)
+                {
+                    *static_cast<T*>(storage) = *static_cast<T const*>(other);
+                }
+
+                template <typename T>
+                static void MoveAssign(void *storage, void *other)
+                {
+                    *static_cast<T*>(storage) = std::move(*static_cast<T*>(other));
+                }
+
+                template <typename T>
+                static bool Equal(void const *lhs, void const *rhs)
+                {
+                    return *static_cast<T const*>(lhs) == *static_cast<T const*>(rhs);
+                }
+
+                template <typename T>
+                static bool Less(void const *lhs, void const *rhs)
+                {
+                    return *static_cast<T const*>(lhs) < *static_cast<T const*>(rhs);
+                }
+
+                static void Destroy(std::size_t index, void *storage) noexcept
+                {
+                    using Function = void (*)(void *);
+                    static constexpr Function kTable[] = {&Destroy<Ts>...};
+                    kTable[index](storage);
+                }
+
+                static void CopyConstruct(std::size_t index, void *storage, void const *other)
+                {
+                    using Function = void (*)(void *, void const *);
+                    static constexpr Function kTable[] = {&CopyConstruct<Ts>...};
+                    kTable[index](storage, other);
+                }
+
+                static void MoveConstruct(std::size_t index, void *storage, void *other)
+                {
+                    using Function = void (*)(void *, void *);
+                    static constexpr Function kTable[] = {&MoveConstruct<Ts>...};
+                    kTable[index](storage, other);
+                }
+
+                static void CopyAssign(std::size_t index, void *storage, void const *other)
+                {
+                    using Function = void (*)(void *, void const *);
+                    static constexpr Function kTable[] = {&CopyAssign<Ts>...};
+                    kTable[index](storage, other);
+                }
+
+                static void MoveAssign(std::size_t index, void *storage, void *other)
+                {
+                    using Function = void (*)(void *, void *);
+                    static constexpr Function kTable[] = {&MoveAssign<Ts>...};
+                    kTable[index](storage, other);
+                }
+
+                static bool Equal(std::size_t index, void const *lhs, void const *rhs)
+                {
+                    using Function = bool (*)(void const *, void const *);
+                    static constexpr Function kTable[] = {&Equal<Ts>...};
+                    return kTable[index](lhs, rhs);
+                }
+
+                static bool Less(std::size_t index, void const *lhs, void const *rhs)
+                {
+                    using Function = bool (*)(void const *, void const *);
+                    static constexpr Function kTable[] = {&Less<Ts>...};
+                    return kTable[index](lhs, rhs);
+                }
+            };
+        } // namespace internal
+
+        /**
+         * \brief A type-safe union holding one value of one of the alternatives Ts, in the manner of C++17
+         *        std::variant.
+         * 
+         * The value is stored inside the Variant. Accessing an alternative which is not held by get() is a
+         * violation and terminates the process; no exception is thrown. If the constructor of an
+         * alternative throws during emplace() or assignment, the Variant holds no value and index() returns
+         * variant_npos.
+         * 
+         * \tparam Ts   the alternatives; each shall be an object type
+         */
+        template <typename... Ts>
+        class Variant final
+        {
+            static_assert(sizeof...(Ts) > 0U, "a Variant shall have at least one alternative");
+
+            using Ops = internal::VariantOps<Ts...>;
+
+            template <std::size_t I>
+            using Alternative = typename std::tuple_element<I, std::tuple<Ts...>>::type;
+
+        public:
+            /**
+             * \brief Constructs a Variant holding a value-initialized first alternative.
+             * 
+             */
+            template <typename First = Alternative<0U>, typename = typename std::enable_if<std::is_default_constructible<First>::value>::type>
+            Variant() noexcept(std::is_nothrow_default_constructible<First>::value) : mIndex{variant_npos}
+            {
+                ::new (Storage()) First();
+                mIndex = 0U;
+            }
+
+            /**
+             * \brief Copy constructor.
+             * 
+             * \param[in] other     the Variant to copy
+             */
+            Variant(Variant const &other) : mIndex{variant_npos}
+            {
+                if (other.mIndex != variant_npos)
+                {
+                    Ops::CopyConstruct(other.mIndex, Storage(), other.Storage());
+                    mIndex = other.mIndex;
+                }
+            }
+
+            /**
+             * \brief Move constructor; other keeps its (moved-from) alternative.
+             * 
+             * \param[in] other     the Variant to move from
+             */
+            Variant(Variant &&other) noexcept(internal::AllNothrowMoveConstructible<Ts...>::value) : mIndex{variant_npos}
+            {
+                if (other.mIndex != variant_npos)
+                {
+                    Ops::MoveConstruct(other.mIndex, Storage(), other.Storage());
+                    mIndex = other.mIndex;
+                }
+            }
+
+            /**
+             * \brief Constructs the alternative which the best overload for value among the alternatives
+             *        selects.
+             * 
+             * \param[in] value     the value
+             */
+            template <typename U, typename = typename std::enable_if<!std::is_same<typename std::decay<U>::type, Variant>::value>::type,
+                      std::size_t I = internal::SelectedIndex<U&&, Ts...>::value>
+            Variant(U &&value) noexcept(std::is_nothrow_constructible<Alternative<I>, U&&>::value) : mIndex{variant_npos}
+            {
+                ::new (Storage()) Alternative<I>(std::forward<U>(value));
+                mIndex = I;
+            }
+
+            /**
+             * \brief Constructs the alternative with index I in place.
+             * 
+             * \param[in] args  the arguments of the constructor of the alternative
+             */
+            template <std::size_t I, typename... Args>
+            explicit Variant(in_place_index_t<I>, Args &&... args) : mIndex{variant_npos}
+            {
+                ::new (Storage()) Alternative<I>(std::forward<Args>(args)...);
+                mIndex = I;
+            }
+
+            /**
+             * \brief Constructs the alternative T in place; T shall occur exactly once among the
+             *        alternatives.
+             * 
+             * \param[in] args  the arguments of the constructor of T
+             */
+            template <typename T, typename... Args, std::size_t I = internal::UniqueIndexOf<T, Ts...>::value,
+                      typename = typename std::enable_if<(I < sizeof...(Ts))>::type>
+            explicit Variant(in_place_type_t<T>, Args &&... args) : mIndex{variant_npos}
+            {
+                ::new (Storage()) T(std::forward<Args>(args)...);
+                mIndex = I;
+            }
+
+            /**
+             * \brief Destructor. Destroys the held alternative.
+             * 
+             */
+            ~Variant()
+            {
+                Reset();
+            }
+
+            /**
+             * \brief Copy assignment.
+             * 
+             * \param[in] other     the Variant to copy
+             * \return Variant&     *this
+             */
+            Variant& operator=(Variant const &other)
+            {
+                if (this != &other)
+                {
+                    if ((mIndex == other.mIndex) && (mIndex != variant_npos))
+                    {
+                        Ops::CopyAssign(mIndex, Storage(), other.Storage());
+                    }
+                    else
+                    {
+                        Reset();
+                        if (other.mIndex != variant_npos)
+                        {
+                            Ops::CopyConstruct(other.mIndex, Storage(), other.Storage());
+                            mIndex = other.mIndex;
+                        }
+                    }
+                }
+                return *this;
+            }
+
+            /**
+             * \brief Move assignment; other keeps its (moved-from) alternative.
+             * 
+             * \param[in] other     the Variant to move from
+             * \return Variant&     *this
+             */
+            Variant& operator=(Variant &&other) noexcept(internal::AllNothrowMoveConstructible<Ts...>::value && internal::AllNothrowMoveAssignable<Ts...>::value)
+            {
+                if (this != &other)
+                {
+                    if ((mIndex == other.mIndex) && (mIndex != variant_npos))
+                    {
+                        Ops::MoveAssign(mIndex, Storage(), other.Storage());
+                    }
+                    else
+                    {
+                        Reset();
+                        if (other.mIndex != variant_npos)
+                        {
+                            Ops::MoveConstruct(other.mIndex, Storage(), other.Storage());
+                            mIndex = other.mIndex;
+                        }
+                    }
+                }
+                return *this;
+            }
+
+            /**
+             * \brief Assigns the alternative which the best overload for value among the alternatives
+             *        selects.
+             * 
+             * \param[in] value     the value
+             * \return Variant&     *this
+             */
+            template <typename U, typename = typename std::enable_if<!std::is_same<typename std::decay<U>::type, Variant>::value>::type,
+                      std::size_t I = internal::SelectedIndex<U&&, Ts...>::value>
+            Variant& operator=(U &&value)
+            {
+                if (mIndex == I)
+                {
+                    *static_cast<Alternative<I>*>(Storage()) = std::forward<U>(value);
+                }
+                else
+                {
+                    emplace<I>(std::forward<U>(value));
+                }
+                return *this;
+            }
+
+            /**
+             * \brief Returns the index of the held alternative.
+             * 
+             * \return std::size_t  the zero-based index, or variant_npos if the Variant holds no value
+             */
+            constexpr std::size_t index() const noexcept
+            {
+                return mIndex;
+            }
+
+            /**
+             * \brief Returns whether the Variant holds no value because the construction of an alternative
+             *        threw.
+             * 
+             * \return true     if index() is variant_npos
+             * \return false    otherwise
+             */
+            constexpr bool valueless_by_exception() const noexcept
+            {
+                return mIndex == variant_npos;
+            }
+
+            /**
+             * \brief Destroys the held alternative and constructs the alternative with index I in place.
+             * 
+             * \param[in] args  the arguments of the constructor of the alternative
+             * \return Alternative<I>&  the new alternative
+             */
+            template <std::size_t I, typename... Args>
+            Alternative<I>& emplace(Args &&... args)
+            {
+                static_assert(I < sizeof...(Ts), "Variant alternative index out of range");
+                Reset();
+                Alternative<I> *const value = ::new (Storage()) Alternative<I>(std::forward<Args>(args)...);
+                mIndex = I;
+                return *value;
+            }
+
+            /**
+             * \brief Destroys the held alternative and constructs the alternative T in place; T shall occur
+             *        exactly once among the alternatives.
+             * 
+             * \param[in] args  the arguments of the constructor of T
+             * \return T&       the new alternative
+             */
+            template <typename T, typename... Args, std::size_t I = internal::UniqueIndexOf<T, Ts...>::value>
+            T& emplace(Args &&... args)
+            {
+                static_assert(I < sizeof...(Ts), "T shall occur exactly once among the alternatives");
+                return emplace<I>(std::forward<Args>(args)...);
+            }
+
+            /**
+             * \brief Exchanges the states of two Variants.
+             * 
+             * \param[in,out] other     the other Variant
+             */
+            void swap(Variant &other)
+            {
+                Variant temporary(std::move(other));
+                other = std::move(*this);
+                *this = std::move(temporary);
+            }
+
+            /**
+             * \brief Returns the storage of the held alternative, for get() and visit().
+             * 
+             * \return void*    the storage
+             */
+            void* Storage() noexcept
+            {
+                return static_cast<void*>(&mStorage);
+            }
+
+            /**
+             * \brief Returns the storage of the held alternative, for get() and visit().
+             * 
+             * \return void const*  the storage
+             */
+            void const* Storage() const noexcept
+            {
+                return static_cast<void const*>(&mStorage);
+            }
+
+        private:
+            void Reset() noexcept
+            {
+                if (mIndex != variant_npos)
+                {
+                    Ops::Destroy(mIndex, Storage());
+                    mIndex = variant_npos;
+                }
+            }
+
+            typename std::aligned_storage<internal::MaxOf({sizeof(Ts)...}), internal::MaxOf({alignof(Ts)...})>::type mStorage;
+            std::size_t mIndex;
+        };
+
+        /**
+         * \brief Returns whether v holds the alternative T; T shall occur exactly once among the
+         *        alternatives.
+         * 
+         * \param[in] v     the Variant
+         * \return true     if v holds T
+         * \return false    otherwise
+         */
+        template <typename T, typename... Ts>
+        constexpr bool holds_alternative(Variant<Ts...> const &v) noexcept
+        {
+            static_assert(internal::UniqueIndexOf<T, Ts...>::value < sizeof...(Ts), "T shall occur exactly once among the alternatives");
+            return v.index() == internal::UniqueIndexOf<T, Ts...>::value;
+        }
+
+        /**
+         * \brief Returns a pointer to the alternative with index I, or nullptr if v holds another one.
+         * 
+         * \param[in] v     the Variant, may be nullptr
+         * \return variant_alternative_t<I, Variant<Ts...>>*    the alternative or nullptr
+         */
+        template <std::size_t I, typename... Ts>
+        variant_alternative_t<I, Variant<Ts...>>* get_if(Variant<Ts...> *v) noexcept
+        {
+            using T = variant_alternative_t<I, Variant<Ts...>>;
+            return ((v != nullptr) && (v->index() == I)) ? static_cast<T*>(v->Storage()) : nullptr;
+        }
+
+        template <std::size_t I, typename... Ts>
+        variant_alternative_t<I, Variant<Ts...>> const* get_if(Variant<Ts...> const *v) noexcept
+        {
+            using T = variant_alternative_t<I, Variant<Ts...>>;
+            return ((v != nullptr) && (v->index() == I)) ? static_cast<T const*>(v->Storage()) : nullptr;
+        }
+
+        /**
+         * \brief Returns a pointer to the alternative T, or nullptr if v holds another one.
+         * 
+         * \param[in] v     the Variant, may be nullptr
+         * \return T*       the alternative or nullptr
+         */
+        template <typename T, typename... Ts>
+        T* get_if(Variant<Ts...> *v) noexcept
+        {
+            static_assert(internal::UniqueIndexOf<T, Ts...>::value < sizeof...(Ts), "T shall occur exactly once among the alternatives");
+            return get_if<internal::UniqueIndexOf<T, Ts...>::value>(v);
+        }
+
+        template <typename T, typename... Ts>
+        T const* get_if(Variant<Ts...> const *v) noexcept
+        {
+            static_assert(internal::UniqueIndexOf<T, Ts...>::value < sizeof...(Ts), "T shall occur exactly once among the alternatives");
+            return get_if<internal::UniqueIndexOf<T, Ts...>::value>(v);
+        }
+
+        /**
+         * \brief Returns the alternative with index I; it is a violation if v holds another one.
+         * 
+         * \param[in] v     the Variant
+         * \return variant_alternative_t<I, Variant<Ts...>>&    the alternative
+         */
+        template <std::size_t I, typename... Ts>
+        variant_alternative_t<I, Variant<Ts...>>& get(Variant<Ts...> &v) noexcept
+        {
+            auto *const value = get_if<I>(&v);
+            if (value == nullptr)
+            {
+                std::terminate();
+            }
+            return *value;
+        }
+
+        template <std::size_t I, typename... Ts>
+        variant_alternative_t<I, Variant<Ts...>> const& get(Variant<Ts...> const &v) noexcept
+        {
+            auto *const value = get_if<I>(&v);
+            if (value == nullptr)
+            {
+                std::terminate();
+            }
+            return *value;
+        }
+
+        template <std::size_t I, typename... Ts>
+        variant_alternative_t<I, Variant<Ts...>>&& get(Variant<Ts...> &&v) noexcept
+        {
+            return std::move(get<I>(v));
+        }
+
+        /**
+         * \brief Returns the alternative T; it is a violation if v holds another one.
+         * 
+         * \param[in] v     the Variant
+         * \return T&       the alternative
+         */
+        template <typename T, typename... Ts>
+        T& get(Variant<Ts...> &v) noexcept
+        {
+            static_assert(internal::UniqueIndexOf<T, Ts...>::value < sizeof...(Ts), "T shall occur exactly once among the alternatives");
+            return get<internal::UniqueIndexOf<T, Ts...>::value>(v);
+        }
+
+        template <typename T, typename... Ts>
+        T const& get(Variant<Ts...> const &v) noexcept
+        {
+            static_assert(internal::UniqueIndexOf<T, Ts...>::value < sizeof...(Ts), "T shall occur exactly once among the alternatives");
+            return get<internal::UniqueIndexOf<T, Ts...>::value>(v);
+        }
+
+        template <typename T, typename... Ts>
+        T&& get(Variant<Ts...> &&v) noexcept
+        {
+            return std::move(get<T>(v));
+        }
+
+        namespace internal
+        {
+            template <typename F, typename V, typename Indices>
+            struct Visitor;
+
+            template <typename F, typename V, std::size_t... Is>
+            struct Visitor<F, V, std::index_sequence<Is...>>
+            {
+                using Result = decltype(std::declval<F>()(get<0U>(std::declval<V>())));
+
+                template <std::size_t I>
+                static Result Call(F &&f, V &&v)
+                {
+                    return std::forward<F>(f)(get<I>(std::forward<V>(v)));
+                }
+
+                static Result Visit(F &&f, V &&v)
+                {
+                    using Function = Result (*)(F &&, V &&);
+                    static constexpr Function kTable[] = {&Call<Is>...};
+                    if (v.index() == variant_npos)
+                    {
+                        std::terminate();
+                    }
+                    return kTable[v.index()](std::forward<F>(f), std::forward<V>(v));
+                }
+            };
+        } // namespace internal
+
+        /**
+         * \brief Calls f with the alternative held by v.
+         * 
+         * f shall return the same type for every alternative. Dispatch uses a table of functions built
+         * at compile time. It is a violation if v holds no value.
+         * 
+         * \param[in] f     the callable
+         * \param[in] v     the Variant
+         * \return the result of f
+         */
+        template <typename F, typename V>
+        auto visit(F &&f, V &&v) -> typename internal::Visitor<F, V, std::make_index_sequence<variant_size<typename std::remove_reference<V>::type>::value>>::Result
+        {
+            return internal::Visitor<F, V, std::make_index_sequence<variant_size<typename std::remove_reference<V>::type>::value>>::Visit(std::forward<F>(f), std::forward<V>(v));
+        }
+
+        /**
+         * \brief Compares two Variants; they are equal if they hold the same alternative with equal values.
+         * 
+         */
+        template <typename... Ts>
+        bool operator==(Variant<Ts...> const &lhs, Variant<Ts...> const &rhs)
+        {
+            if (lhs.index() != rhs.index())
+            {
+                return false;
+            }
+            return (lhs.index() == variant_npos) || internal::VariantOps<Ts...>::Equal(lhs.index(), lhs.Storage(), rhs.Storage());
+        }
+
+        /**
+         * \brief Compares two Variants for inequality.
+         * 
+         */
+        template <typename... Ts>
+        bool operator!=(Variant<Ts...> const &lhs, Variant<Ts...> const &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * \brief Orders two Variants by the index of their alternatives, and by value if the index is the
+         *        same; a Variant without value is less than any other.
+         * 
+         */
+        template <typename... Ts>
+        bool operator<(Variant<Ts...> const &lhs, Variant<Ts...> const &rhs)
+        {
+            if (rhs.index() == variant_npos)
+            {
+                return false;
+            }
+            if (lhs.index() == variant_npos)
+            {
+                return true;
+            }
+            if (lhs.index() != rhs.index())
+            {
+                return lhs.index() < rhs.index();
+            }
+            return internal::VariantOps<Ts...>::Less(lhs.index(), lhs.Storage(), rhs.Storage());
+        }
+
+        /**
+         * \brief Exchanges the states of two Variants.
+         * 
+         */
+        template <typename... Ts>
+        void swap(Variant<Ts...> &lhs, Variant<Ts...> &rhs)
+        {
+            lhs.swap(rhs);
+        }
+    } // namespace core
+    
+} // namespace ara
+
+
+#endif // ARA_CORE_VARIANT_H_
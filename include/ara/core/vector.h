@@ -0,0 +1,35 @@
+/**
+ * \file vector.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_CORE_VECTOR_H_
+#define ARA_CORE_VECTOR_H_
+
+#include <memory>
+#include <vector>
+
+namespace ara
+{
+    namespace core
+    {
+        // SWS_CORE_01301
+        /**
+         * \brief A sequence container that encapsulates dynamically sized arrays.
+         * 
+         * \tparam T            the type of contained values
+         * \tparam Allocator    the type of Allocator to use for this container
+         */
+        template <typename T, typename Allocator = std::allocator<T>>
+        using Vector = std::vector<T, Allocator>;
+    } // namespace core
+    
+} // namespace ara
+
+
+#endif // ARA_CORE_VECTOR_H_
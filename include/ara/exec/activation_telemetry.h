@@ -0,0 +1,136 @@
+/**
+ * \file activation_telemetry.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_EXEC_ACTIVATION_TELEMETRY_H_
+#define ARA_EXEC_ACTIVATION_TELEMETRY_H_
+
+#include <atomic>
+#include <cstdint>
+#include <sys/types.h>
+#include "ara/core/result.h"
+#include "ara/exec/exec_error_domain.h"
+
+namespace ara
+{
+    namespace exec
+    {
+        /**
+         * Number of buckets of a TelemetryHistogram .
+         */
+        constexpr std::uint32_t kTelemetryHistogramBuckets = 128U;
+
+        /**
+         * Maximum number of worker threads whose spans are recorded .
+         */
+        constexpr std::uint32_t kTelemetryMaxWorkers = 64U;
+
+        /**
+         * Log-linear histogram of durations in nanoseconds, living in shared memory.
+         * 
+         * A duration d < 4 is counted in bucket d. A duration d >= 4 is counted in bucket
+         * 4 * (floor(log2(d)) - 1) + (the two bits following the leading one of d), i.e. every power of two
+         * from 4 on is split into four buckets, with a relative resolution of 25 %. The buckets cover
+         * durations below 2^33 ns; longer durations land in the last bucket.
+         * 
+         * Every histogram has exactly one writing thread, which updates it with relaxed atomic stores, so
+         * recording costs a few nanoseconds and never blocks. Readers may see a sample in count before it
+         * shows up in its bucket, but never a torn value.
+         */
+        struct TelemetryHistogram
+        {
+            std::atomic<std::uint64_t> buckets[kTelemetryHistogramBuckets];    // samples per bucket
+            std::atomic<std::uint64_t> count;                                   // number of samples
+            std::atomic<std::uint64_t> sumNs;                                   // sum of all samples
+            std::atomic<std::uint64_t> maxNs;                                   // largest sample
+        };
+
+        /**
+         * Timestamps of the most recent complete activation cycle, protected by a seqlock: the writer makes
+         * sequence odd while updating, readers retry while it is odd or changed. The fields are atomics
+         * accessed with relaxed ordering, the ordering is provided by the release and acquire accesses of
+         * sequence and an acquire fence before the reader's second load of it .
+         */
+        struct TelemetryCycleRecord
+        {
+            std::atomic<std::uint32_t> sequence;    // seqlock counter
+            std::atomic<std::uint8_t> phase;        // ActivationReturnType of the cycle
+            std::atomic<std::uint64_t> cycle;       // activation cycle number
+            std::atomic<std::uint64_t> startNs;     // CLOCK_MONOTONIC time WaitForNextActivation() returned
+            std::atomic<std::uint64_t> endNs;       // CLOCK_MONOTONIC time the next WaitForNextActivation()
+                                                    // was called
+            std::atomic<std::uint64_t> deadlineNs;  // scheduled deadline of the next activation
+        };
+
+        /**
+         * Layout of the shared-memory segment "/ara_exec_telemetry.<pid>" a DeterministicClient publishes
+         * its activation timing to, when ActivationConfig::publishTelemetry is set .
+         * 
+         * Slack is the time between the end of a cycle and the deadline of the next activation; an overrun
+         * is a cycle which ended after that deadline.
+         * 
+         * Spans are recorded for the first kTelemetryMaxWorkers workers only. workerCount holds the actual
+         * size of the pool, so a reader detects a pool whose remaining workers are not recorded by
+         * workerCount > kTelemetryMaxWorkers.
+         */
+        struct ActivationTelemetrySegment
+        {
+            std::uint32_t magic;                                    // kActivationTelemetryMagic
+            std::uint32_t layoutVersion;                            // incremented with incompatible changes
+            std::uint32_t workerCount;                              // workers of the pool, see above
+            std::atomic<std::uint64_t> cycleCount;                  // completed activation cycles
+            std::atomic<std::uint64_t> overrunCount;                // see GetOverrunCount()
+            TelemetryHistogram phaseDuration[5];                    // cycle duration per ActivationReturnType
+            TelemetryHistogram wakeupLatency;                       // actual wake-up minus scheduled deadline
+            TelemetryHistogram slack;                               // slack of kRun cycles
+            TelemetryHistogram workerSpan[kTelemetryMaxWorkers];    // time per worker inside one
+                                                                    // RunWorkerPool (...) call
+            TelemetryCycleRecord lastCycle;                         // the most recent cycle
+        };
+
+        /**
+         * Magic number at the start of an ActivationTelemetrySegment ("ARAT") .
+         */
+        constexpr std::uint32_t kActivationTelemetryMagic = 0x54415241U;
+
+        /**
+         * Read-only access to the activation telemetry of a running process, for external tools. Opening
+         * and reading do not interrupt or slow down the observed process .
+         */
+        class ActivationTelemetryReader
+        {
+            /**
+             * Maps the telemetry segment of a process read-only .
+             * 
+             * \param[in]   pid     process id of the observed process
+             * 
+             * \return Result<ActivationTelemetryReader>    the reader, or kCommunicationError if the
+             *                                              process does not publish telemetry
+             */
+            static Result<ActivationTelemetryReader> Open(pid_t pid) noexcept;
+
+            /**
+             * Destructor. Unmaps the segment .
+             */
+            ~ActivationTelemetryReader() noexcept;
+
+            /**
+             * Returns the mapped segment. It stays valid for the lifetime of the reader, also when the observed
+             * process exits .
+             * 
+             * \return ActivationTelemetrySegment const&    the segment
+             */
+            ActivationTelemetrySegment const& GetSegment() const noexcept;
+        };
+    } // namespace exec
+    
+} // namespace ara
+
+
+#endif // ARA_EXEC_ACTIVATION_TELEMETRY_H_
@@ -14,7 +14,10 @@
 // Base on the AUTOSAR_SWS_ExecutionManagement.pdf
 // AUTOSAR AP R19-11
 
+#include <chrono>
 #include <cstdint>
+#include "ara/core/span.h"
+#include "ara/exec/activation_telemetry.h"
 
 namespace ara
 {
@@ -49,6 +52,94 @@ namespace ara
             kNotAvailable = 1,
         };
 
+        /**
+         * Point in time of an activation, on the CLOCK_MONOTONIC time base .
+         */
+        using TimeStamp = std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds>;
+
+        /**
+         * Defines how the activation loop thread waits for the next activation. Scoped Enumeration of uint8_t .
+         */
+        enum class ActivationTimer : uint8_t
+        {
+            kClockNanosleep = 0,    // clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME) on the next deadline
+            kTimerFd = 1,           // periodic timerfd on CLOCK_MONOTONIC, read blocking; the kernel also
+                                    // counts expirations missed while the cycle was running
+        };
+
+        /**
+         * Configuration of the cyclic activation served by DeterministicClient::WaitForNextActivation() .
+         */
+        struct ActivationConfig
+        {
+            std::chrono::nanoseconds cyclePeriod{0};        // period of the kRun activations, 0 means the
+                                                            // period deployed in the manifest
+            ActivationTimer timer = ActivationTimer::kClockNanosleep;
+            std::int32_t fifoPriority = 0;                  // SCHED_FIFO priority (1..99) of the calling
+                                                            // thread, 0 keeps the current policy
+            std::int32_t cpu = -1;                          // CPU the calling thread is pinned to, -1 means
+                                                            // no pinning
+            bool lockMemory = false;                        // mlockall(MCL_CURRENT | MCL_FUTURE) to avoid
+                                                            // page faults during the cycle
+            bool publishTelemetry = false;                  // publish cycle timing to shared memory, see
+                                                            // ActivationTelemetrySegment
+        };
+
+        /**
+         * Configuration of the worker pool used by DeterministicClient::RunWorkerPool() .
+         */
+        struct WorkerPoolConfig
+        {
+            std::uint32_t workerCount = 0U;         // number of workers including the calling thread,
+                                                    // 0 means one per CPU of cpuAffinityMask
+            std::uint64_t cpuAffinityMask = 0U;     // bit n pins a worker to CPU n, workers 1 to
+                                                    // workerCount - 1 are pinned in ascending CPU order;
+                                                    // worker 0 keeps the pinning of the calling thread;
+                                                    // 0 means no pinning
+            std::uint32_t chunkSize = 0U;           // container elements per chunk, 0 means the container is
+                                                    // split into 4 chunks per worker
+        };
+
+        /**
+         * Handle of the worker thread calling Worker::workerRunnable (...) . It is only valid during that call.
+         */
+        class WorkerThread
+        {
+            /**
+             * Returns the index of the worker thread in the pool, in the range [0, workerCount) . Index 0
+             * is the thread that called RunWorkerPool (...) .
+             * 
+             * \return     std::uint32_t   the worker index
+             */
+            std::uint32_t GetWorkerIndex() const noexcept;
+        };
+
+        /**
+         * Stream of deterministic random numbers, see DeterministicClient::GetRandomStream (...) .
+         * 
+         * The stream is a Philox4x32-10 counter-based generator: the n-th number is a pure function of the
+         * stream key and n, so there is no shared state and streams can be used by different threads
+         * without locking. Copying a stream copies its position.
+         */
+        class RandomStream
+        {
+            /**
+             * Returns the next 64 bit uniform distributed pseudo random number of the stream .
+             * 
+             * \return uint64_t     the random number
+             */
+            uint64_t Next() noexcept;
+
+            /**
+             * Fills a buffer with the next numbers of the stream, in the same order repeated calls of Next()
+             * would return them. Several counter blocks are evaluated per instruction with AVX2 or NEON
+             * where available .
+             * 
+             * \param[out]  values  the buffer to fill
+             */
+            void Fill(ara::core::Span<uint64_t> values) noexcept;
+        };
+
         // SWS_EM_02210
         /**
          * Class to implement operations on Deterministic Client .
@@ -69,12 +160,35 @@ namespace ara
              */
             ~DeterministicClient() const noexcept;
 
+            /**
+             * Constructor for DeterministicClient with an explicitly configured worker pool. The workerCount - 1
+             * worker threads are created and pinned here, once, and are reused by every RunWorkerPool (...)
+             * call .
+             * 
+             * \param[in]   config      the worker pool configuration
+             */
+            explicit DeterministicClient(WorkerPoolConfig const &config) noexcept;
+
+            /**
+             * Constructor for DeterministicClient with an explicitly configured activation loop and worker
+             * pool .
+             * 
+             * \param[in]   activation  the activation configuration, applied to the calling thread
+             * \param[in]   workerPool  the worker pool configuration
+             */
+            DeterministicClient(ActivationConfig const &activation, WorkerPoolConfig const &workerPool) noexcept;
+
             // SWS_EM_02216
             /**
              * Blocks and returns with a process control value when the next activation is triggered by the
              * Runtime.
              * 
              * \return      ActivationReturnType.
+             * 
+             * kRun activations are scheduled on absolute deadlines start + n * cyclePeriod on CLOCK_MONOTONIC,
+             * so wake-up latencies do not accumulate into drift. If the cycle is still running when a deadline
+             * passes, that activation is counted as overrun and skipped; the next activation is the first
+             * deadline lying in the future, see GetOverrunCount() .
              */
             ActivationReturnType WaitForNextActivation() const noexcept;
 
@@ -92,7 +206,22 @@ namespace ara
              *                              operator++
              * 
              * \return void
+             * 
+             * The container is walked once with operator++ to cut it into chunks of consecutive elements.
+             * Chunk c is queued on the work-stealing deque of worker (c mod workerCount); a worker takes
+             * chunks from the front of its own deque and, once it is empty, steals from the back of the
+             * others. Every element is passed exactly once to runnableObj.workerRunnable(element, thread),
+             * and the call returns when all elements are done. The calling thread is one of the workerCount
+             * workers: it is worker 0, owns deque 0 and processes chunks 0, workerCount, 2 * workerCount, ...
+             * like any other worker instead of idling. With workerCount 1, all chunks are processed by the
+             * calling thread.
+             * 
+             * Which worker processes an element depends on timing, so workerRunnable (...) shall only
+             * write results into the element itself or into a slot selected by the element, and shall draw
+             * random numbers from a stream selected by the element, see GetRandomStream (...) . The result of
+             * the cycle is then identical in redundant executions.
              */
+            template <typename Worker, typename Container>
             void RunWorkerPool(Worker &runnableObj, Container &container) const noexcept;
 
             // SWS_EM_02225
@@ -106,6 +235,31 @@ namespace ara
              */
             uint64_t GetRandom() const noexcept;
 
+            /**
+             * Fills a buffer with the next 'Deterministic' random numbers, the same numbers the corresponding
+             * number of GetRandom() calls would return .
+             * 
+             * \param[out]  values  the buffer to fill
+             * 
+             * \note The numbers come from a Philox4x32-10 stream keyed by the process seed assigned by
+             *       Execution Management, the activation cycle number and the key domain of the main
+             *       thread, which is why they are reproduced in redundant executions.
+             */
+            void GetRandom(ara::core::Span<uint64_t> values) const noexcept;
+
+            /**
+             * Returns an independent stream of 'Deterministic' random numbers for the current activation
+             * cycle. The streams use a key domain separate from the one of GetRandom() , so no streamId,
+             * including 0, reproduces the numbers of the main thread .
+             * 
+             * \param[in]   streamId    selects the stream; inside RunWorkerPool (...) the index of
+             *                          the processed element is a suitable choice
+             * 
+             * \return RandomStream     a stream keyed by process seed, activation cycle, the
+             *                          worker stream key domain and streamId
+             */
+            RandomStream GetRandomStream(uint64_t streamId) const noexcept;
+
             // SWS_EM_02230
             /**
              * This provides the timestamp that represents the point in time when the activation was triggered
@@ -113,11 +267,12 @@ namespace ara
              * within an activation cycle will always provide the same value. The same value will also be
              * provided within redundantly executed Processes .
              * 
-             * \param       TimeStamp   DIRECTION NOT DEFINED
+             * \param[out]  timeStamp   the scheduled deadline of the current activation, not the
+             *                          (jittered) time the thread actually woke up
              * 
              * \return      ActivationTimeStampReturnType
              */
-            ActivationTimeStampReturnType GetActivationTime(TimeStamp) const noexcept;
+            ActivationTimeStampReturnType GetActivationTime(TimeStamp &timeStamp) const noexcept;
 
             // SWS_EM_02235
             /**
@@ -126,11 +281,19 @@ namespace ara
              * Subsequent calls within an activation cycle will always provide the same value. The same value
              * will also be provided within redundantly executed RefES{Process} .
              * 
-             * \param       TimeStamp   DIRECTION NOT DEFINED
+             * \param[out]  timeStamp   the scheduled deadline of the next activation
              * 
              * \return      ActivationTimeStampReturnType
              */
-            ActivationTimeStampReturnType GetNextActivationTime(TimeStamp) const noexcept;
+            ActivationTimeStampReturnType GetNextActivationTime(TimeStamp &timeStamp) const noexcept;
+
+            /**
+             * Returns the number of kRun activations skipped because the previous cycle overran its deadline,
+             * since the DeterministicClient was constructed .
+             * 
+             * \return uint64_t     number of overruns
+             */
+            uint64_t GetOverrunCount() const noexcept;
         };
     } // namespace exec
     
@@ -40,6 +40,9 @@ namespace ara
             // SWS_EM_02030
             /**
              * Constructor that creates the Execution Client. 
+             * 
+             * If the environment variable ARA_EM_SOCKET is set, the client connects to the
+             * LocalExecutionManager listening on that socket.
              */
             ExecutionClient() noexcept;
 
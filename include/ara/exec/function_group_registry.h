@@ -0,0 +1,168 @@
+/**
+ * \file function_group_registry.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_EXEC_FUNCTION_GROUP_REGISTRY_H_
+#define ARA_EXEC_FUNCTION_GROUP_REGISTRY_H_
+
+#include <cstdint>
+#include "ara/core/result.h"
+#include "ara/exec/exec_error_domain.h"
+
+namespace ara
+{
+    namespace exec
+    {
+        /**
+         * \brief Dense identifier of a Function Group, in the range [0, GetFunctionGroupCount()).
+         * 
+         */
+        using FunctionGroupId = std::uint16_t;
+
+        /**
+         * \brief Machine-wide dense identifier of a Function Group State, in the range
+         *        [0, GetStateCount()). The states of one Function Group have consecutive identifiers.
+         * 
+         */
+        using FunctionGroupStateId = std::uint32_t;
+
+        /**
+         * \brief Interned table of all Function Groups and Function Group States of the machine.
+         * 
+         * The table is built once from the machine manifest, at the first Preconstruct() of a FunctionGroup
+         * or FunctionGroupState, and is immutable afterwards, so lookups need no locking. Short name paths
+         * are stored in an open-addressing hash table keyed by a 64 bit hash of the path; a lookup hashes
+         * the path once and compares the string only on a hash match.
+         * 
+         * \note Thread-safe
+         */
+        class FunctionGroupRegistry
+        {
+            /**
+             * \brief Returns the registry of the machine, loading the machine manifest on first use.
+             * 
+             * \return Result<FunctionGroupRegistry const *>   the registry, or kGeneralError if the manifest
+             *                                                  cannot be read
+             */
+            static Result<FunctionGroupRegistry const *> Get() noexcept;
+
+            /**
+             * \brief Looks up a Function Group by its short name path.
+             * 
+             * \param[in] metaModelIdentifier   short name path of the Function Group
+             * \return Result<FunctionGroupId>  the identifier, or kMetaModelError if no Function
+             *                                  Group has this path
+             */
+            Result<FunctionGroupId> FindFunctionGroup(ara::core::StringView metaModelIdentifier) const noexcept;
+
+            /**
+             * \brief Looks up a state of a Function Group by its short name path.
+             * 
+             * \param[in] functionGroup         the Function Group the state belongs to
+             * \param[in] metaModelIdentifier   short name path of the state
+             * \return Result<FunctionGroupStateId>     the identifier, or kMetaModelError if the Function
+             *                                          Group has no such state
+             */
+            Result<FunctionGroupStateId> FindState(FunctionGroupId functionGroup, ara::core::StringView metaModelIdentifier) const noexcept;
+
+            /**
+             * \brief Returns the number of Function Groups of the machine.
+             * 
+             * \return std::uint32_t    the number of Function Groups
+             */
+            std::uint32_t GetFunctionGroupCount() const noexcept;
+
+            /**
+             * \brief Returns the number of Function Group States of the machine.
+             * 
+             * \return std::uint32_t    the number of states, i.e. the number of rows of a TransitionTable
+             */
+            std::uint32_t GetStateCount() const noexcept;
+
+            /**
+             * \brief Returns the identifier of the first state of a Function Group.
+             * 
+             * The states of the Function Group are [GetFirstState(fg), GetFirstState(fg) + GetStateCount(fg)).
+             * 
+             * \param[in] functionGroup     the Function Group
+             * \return FunctionGroupStateId the first state
+             */
+            FunctionGroupStateId GetFirstState(FunctionGroupId functionGroup) const noexcept;
+
+            /**
+             * \brief Returns the number of states of a Function Group.
+             * 
+             * \param[in] functionGroup     the Function Group
+             * \return std::uint32_t        the number of states
+             */
+            std::uint32_t GetStateCount(FunctionGroupId functionGroup) const noexcept;
+
+            /**
+             * \brief Returns the Function Group a state belongs to.
+             * 
+             * \param[in] state         the state
+             * \return FunctionGroupId  the Function Group
+             */
+            FunctionGroupId GetFunctionGroup(FunctionGroupStateId state) const noexcept;
+
+            /**
+             * \brief Returns the short name path of a state.
+             * 
+             * \param[in] state     the state
+             * \return ara::core::StringView    the path, valid for the lifetime of the process
+             */
+            ara::core::StringView GetStatePath(FunctionGroupStateId state) const noexcept;
+        };
+
+        /**
+         * \brief Flat table holding one T per pair of Function Group States of the same Function Group,
+         *        e.g. the transition rules of a state manager.
+         * 
+         * The entries of a Function Group with n states form an n x n block, stored row-major; the block of
+         * group i starts at the prefix sum of n_j * n_j over the groups j < i. The table precomputes for every
+         * state s its row base, block offset + (s - GetFirstState(group)) * n, and its column, s -
+         * GetFirstState(group), so At(from, to) loads the row base of from and the column of to and adds
+         * them: two loads from per-state arrays and the load of the entry, without looking up the group.
+         * 
+         * \tparam T    the type of the entries
+         */
+        template <typename T>
+        class TransitionTable
+        {
+            /**
+             * \brief Creates a table for all Function Groups of the registry, with value-initialized entries.
+             * 
+             * \param[in] registry  the registry
+             */
+            explicit TransitionTable(FunctionGroupRegistry const &registry);
+
+            /**
+             * \brief Returns the entry for a transition.
+             * 
+             * \param[in] from  the current state
+             * \param[in] to    the requested state, of the same Function Group as from
+             * \return T&       the entry
+             */
+            T& At(FunctionGroupStateId from, FunctionGroupStateId to) noexcept;
+
+            /**
+             * \brief Returns the entry for a transition.
+             * 
+             * \param[in] from  the current state
+             * \param[in] to    the requested state, of the same Function Group as from
+             * \return T const& the entry
+             */
+            T const& At(FunctionGroupStateId from, FunctionGroupStateId to) const noexcept;
+        };
+    } // namespace exec
+    
+} // namespace ara
+
+
+#endif // ARA_EXEC_FUNCTION_GROUP_REGISTRY_H_
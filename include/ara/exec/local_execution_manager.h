@@ -0,0 +1,231 @@
+/**
+ * \file local_execution_manager.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_EXEC_LOCAL_EXECUTION_MANAGER_H_
+#define ARA_EXEC_LOCAL_EXECUTION_MANAGER_H_
+
+// Lightweight stand-in for Execution Management on development machines. It serves the
+// ExecutionClient and StateClient of the processes it starts, but implements no platform
+// security, resource groups or manifest validation.
+
+#include <chrono>
+#include <cstdint>
+#include <sys/types.h>
+#include "ara/core/result.h"
+#include "ara/core/string.h"
+#include "ara/core/vector.h"
+#include "ara/exec/exec_error_domain.h"
+#include "ara/exec/execution_client.h"
+
+namespace ara
+{
+    namespace exec
+    {
+        /**
+         * \brief Environment variable through which started processes find the socket of the
+         *        LocalExecutionManager. ExecutionClient and StateClient connect to it when it is set.
+         */
+        constexpr char const *kLocalEmSocketEnv = "ARA_EM_SOCKET";
+
+        /**
+         * \brief Defines how the LocalExecutionManager creates processes.
+         * 
+         */
+        enum class LaunchMode : uint8_t
+        {
+            kPosixSpawn = 0,    /*< Every process is created with posix_spawn() of its executable. */
+            kZygote = 1,        /*< Processes with a zygoteLibrary are forked from a pre-initialized zygote
+                                    process; the others are spawned as with kPosixSpawn. */
+        };
+
+        /**
+         * \brief Signature of the entry point a zygote child calls instead of main().
+         * 
+         */
+        using ZygoteEntryPoint = int (*)(int argc, char *argv[]);
+
+        /**
+         * \brief Name of the ZygoteEntryPoint symbol exported by a zygote library.
+         * 
+         */
+        constexpr char const *kZygoteEntrySymbol = "AraZygoteMain";
+
+        /**
+         * \brief Describes a process the LocalExecutionManager can start.
+         * 
+         */
+        struct ProcessDescription
+        {
+            ara::core::String name;                                 /*< Unique name of the process. */
+            ara::core::String executable;                           /*< Path of the executable. */
+            ara::core::Vector<ara::core::String> arguments;         /*< Command line arguments. */
+            ara::core::Vector<ara::core::String> states;            /*< Function Group states the process runs in,
+                                                                        as "FunctionGroup/State" paths. */
+            ara::core::Vector<ara::core::String> dependsOn;         /*< Processes which have to report kRunning
+                                                                        before this one is started. */
+            std::chrono::milliseconds startupTimeout{5000};         /*< Maximum time from spawn to kRunning. */
+            std::chrono::milliseconds terminationTimeout{2000};     /*< Maximum time from SIGTERM to exit, after
+                                                                        which SIGKILL is sent. */
+            ara::core::String zygoteLibrary;                        /*< Shared library exporting kZygoteEntrySymbol,
+                                                                        built from the same sources as executable.
+                                                                        Empty if the process cannot be forked from
+                                                                        the zygote. */
+        };
+
+        /**
+         * \brief Configuration of the zygote process.
+         * 
+         * The zygote is started once by LocalExecutionManager::Start(). It loads libara and the zygote
+         * libraries (resolving all relocations with RTLD_NOW), runs their static initializers, calls
+         * ara::core::Initialize(), and maps the listed storages read-only; then it waits for fork requests. A forked
+         * child closes the zygote's socket, opens its own ExecutionClient connection, sets its arguments,
+         * and calls the entry point of its library, which reports ExecutionState::kRunning through the
+         * usual ReportExecutionState() path.
+         * 
+         * \note fork() only duplicates the calling thread, so the zygote shall not start threads before
+         *       forking: ara::log and the Persistency start their worker threads lazily on first use in the
+         *       child. Per-process state such as random seeds is re-initialized in the child.
+         * 
+         * \note The zygote never opens a writable storage, because every child would inherit it and several
+         *       writers would share one journal and in-memory index. Key-value storages are opened as
+         *       SharedKeyValueStorageReader views, which requires another process to publish them, and file
+         *       storages only have their files mapped with MapFileReadOnly(). A child that writes opens its
+         *       own KeyValueStorage or FileStorage after the fork, and benefits from the warm page cache.
+         */
+        struct ZygoteConfig
+        {
+            ara::core::Vector<ara::core::String> preloadLibraries;      /*< Additional libraries to load. */
+            ara::core::Vector<ara::core::String> keyValueStorages;      /*< Published key-value storages to open
+                                                                            read-only with
+                                                                            OpenSharedKeyValueStorage() before
+                                                                            forking, as InstanceSpecifier paths. */
+            ara::core::Vector<ara::core::String> fileStorages;          /*< File storages whose files are mapped
+                                                                            read-only before forking. */
+        };
+
+        /**
+         * \brief Startup timestamps of one process, on CLOCK_MONOTONIC.
+         * 
+         * The startup latency of the process is runningNs - requestedNs; spawnedNs - requestedNs is the time
+         * spent waiting for dependencies and in posix_spawn() or the zygote fork.
+         */
+        struct ProcessStartupRecord
+        {
+            ara::core::String name;     /*< Name of the process. */
+            pid_t pid;                  /*< Process id. */
+            std::uint64_t requestedNs;  /*< The state transition requiring the process began. */
+            std::uint64_t spawnedNs;    /*< posix_spawn() returned, or the zygote reported the pid of the
+                                            forked child. */
+            std::uint64_t runningNs;    /*< The process reported ExecutionState::kRunning, 0 if it has not. */
+            bool forkedFromZygote;      /*< true if the process was forked from the zygote. */
+        };
+
+        /**
+         * \brief Outcome and timestamps of one Function Group state transition, on CLOCK_MONOTONIC.
+         * 
+         */
+        struct TransitionRecord
+        {
+            ara::core::String functionGroup;    /*< The Function Group. */
+            ara::core::String targetState;      /*< The requested state. */
+            std::uint64_t requestedNs;          /*< SetState() was received. */
+            std::uint64_t finishedNs;           /*< The transition completed, failed or was cancelled. */
+            bool failed;                        /*< true if the transition did not succeed. */
+            ExecErrc error;                     /*< kFailed or kCancelled; only meaningful if failed is true. */
+        };
+
+        /**
+         * \brief Configuration of the LocalExecutionManager.
+         * 
+         */
+        struct LocalExecutionManagerConfig
+        {
+            ara::core::String socketPath;                           /*< Path of the Unix domain socket (SOCK_SEQPACKET)
+                                                                        the clients connect to. */
+            ara::core::Vector<ProcessDescription> processes;        /*< All processes of the machine. */
+            ara::core::String initialMachineState = "MachineFG/Startup";/*< State entered by Start(). */
+            LaunchMode launchMode = LaunchMode::kPosixSpawn;        /*< How processes are created. */
+            ZygoteConfig zygote;                                    /*< Used with LaunchMode::kZygote. */
+        };
+
+        /**
+         * \brief Execution Management stand-in running inside a developer-provided host process.
+         * 
+         * For a state transition, the processes required by the new state form a dependency graph over
+         * ProcessDescription::dependsOn. Every process whose dependencies have reported kRunning is
+         * spawned at once with posix_spawn(), so independent processes start in parallel and the
+         * transition takes as long as the longest dependency chain instead of the sum of all startups.
+         * ExecutionClient::ReportExecutionState() arrives over the socket, identified by the peer
+         * credentials (SO_PEERCRED) of the connection.
+         * 
+         * A transition is a single pass over that graph, running teardown and startup concurrently:
+         * - processes not part of the new state receive SIGTERM as soon as every process depending on them
+         *   has exited, so independent processes are terminated in parallel;
+         * - processes of the new state are spawned as soon as their dependencies are running, without
+         *   waiting for unrelated processes to terminate.
+         * 
+         * Transitions of different Function Groups are independent and overlap. A process which exits
+         * or fails to spawn before reporting kRunning, or misses its startupTimeout, fails the transition
+         * with kFailed at once: processes depending on it are not spawned and the Future of SetState()
+         * becomes ready without waiting for the rest. A newer SetState() for the same Function Group
+         * cancels the ongoing transition with kCancelled and continues from the processes already running.
+         * 
+         * \note Start() rejects dependency cycles with ExecErrc::kInvalidArguments.
+         */
+        class LocalExecutionManager
+        {
+            /**
+             * \brief Constructs a LocalExecutionManager. Nothing is started yet.
+             * 
+             * \param[in] config    The machine configuration.
+             */
+            explicit LocalExecutionManager(LocalExecutionManagerConfig config) noexcept;
+
+            /**
+             * \brief Stops all processes (SIGTERM, then SIGKILL after their timeout) and closes the socket.
+             * 
+             */
+            ~LocalExecutionManager() noexcept;
+
+            /**
+             * \brief Opens the socket and performs the transition to the initial machine state.
+             * 
+             * \return Result<void>     void, or kInvalidArguments if the configuration is
+             *                          inconsistent, kCommunicationError if the socket cannot be
+             *                          opened, or the error of the initial transition.
+             * 
+             * Not thread-safe
+             */
+            Result<void> Start() noexcept;
+
+            /**
+             * \brief Returns the startup records of all processes started so far, in start order.
+             * 
+             * \return ara::core::Vector<ProcessStartupRecord>  the records
+             * 
+             * Thread-safe
+             */
+            ara::core::Vector<ProcessStartupRecord> GetStartupRecords() const noexcept;
+
+            /**
+             * \brief Returns the records of all finished state transitions, in completion order.
+             * 
+             * \return ara::core::Vector<TransitionRecord>  the records
+             * 
+             * Thread-safe
+             */
+            ara::core::Vector<TransitionRecord> GetTransitionRecords() const noexcept;
+        };
+    } // namespace exec
+    
+} // namespace ara
+
+
+#endif // ARA_EXEC_LOCAL_EXECUTION_MANAGER_H_
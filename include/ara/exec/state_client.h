@@ -15,6 +15,7 @@
 // AUTOSAR AP R19-11
 
 #include "ara/core/result.h"
+#include "ara/exec/function_group_registry.h"
 
 namespace ara
 {
@@ -45,6 +46,9 @@ namespace ara
              * \errors      ara::exec::ExecErrc::kMetaModelError    if metaModelIdentifier passed is incorrect (e.g.
              *                                                      FunctionGroupState identifier has been passed).
              *              ara::exec::ExecErrc::kGeneralError      if any other error occurs
+             * 
+             * \note The path is resolved with FunctionGroupRegistry::FindFunctionGroup(), a hash lookup; the
+             *       token only carries the resulting FunctionGroupId.
              */
             static Result<FunctionGroup::CtorToken> Preconstruct(ara::core::StringView metaModelIdentifier) noexcept;
 
@@ -76,6 +80,8 @@ namespace ara
              * \return false        otherwise.
              * 
              * Thread-safe
+             * 
+             * \note Compares the interned FunctionGroupIds only.
              */
             bool operator==(FunctionGroup const &other) const noexcept;
 
@@ -91,6 +97,15 @@ namespace ara
              * Thread-safe
              */
             bool operator!=(FunctionGroup const &other) const noexcept;
+
+            /**
+             * \brief Returns the interned identifier of the Function Group.
+             * 
+             * \return FunctionGroupId  the identifier
+             * 
+             * Thread-safe
+             */
+            FunctionGroupId GetId() const noexcept;
         };
 
         // SWS_EM_02269
@@ -119,6 +134,8 @@ namespace ara
              *                                                              ErrorDomain error.
              * 
              * Thread-safe
+             * 
+             * \note The path is resolved with FunctionGroupRegistry::FindState(), a hash lookup.
              */
             static Result<FunctionGroupState::CtorToken> Preconstruct(FunctionGroup const &functionGroup, ara::core::StringView metaModelIdentifier) noexcept;
 
@@ -150,6 +167,8 @@ namespace ara
              * \return false        otherwise
              * 
              * Thread-safe
+             * 
+             * \note Compares the interned FunctionGroupStateIds only.
              */
             bool operator==(FunctionGroupState const &other) const noexcept;
 
@@ -166,6 +185,16 @@ namespace ara
              * Thread-safe
              */
             bool operator!=(FunctionGroupState const &other) const noexcept;
+
+            /**
+             * \brief Returns the interned identifier of the Function Group State, usable as index into a
+             *        TransitionTable.
+             * 
+             * \return FunctionGroupStateId     the identifier
+             * 
+             * Thread-safe
+             */
+            FunctionGroupStateId GetId() const noexcept;
         };
 
         // SWS_EM_02275
@@ -183,6 +212,8 @@ namespace ara
             /**
              * \brief Constructor that creates StateClient instance
              * 
+             * If the environment variable ARA_EM_SOCKET is set, the client connects to the
+             * LocalExecutionManager listening on that socket.
              */
             StateClient() noexcept;
 
@@ -201,6 +232,12 @@ namespace ara
              * immediately. Returned ara::core::Future can be used to determine result of requested
              * transition.
              * 
+             * Requests for different Function Groups are executed concurrently, so issuing SetState() for
+             * several independent Function Groups lets their transitions overlap. Within a transition,
+             * processes are terminated and started in parallel as far as their declared dependencies
+             * allow. The Future reports kFailed as soon as one process fails, not after all have finished
+             * or timed out.
+             * 
              * \param[in] state     representing meta-model definition of a state inside
              *                      a specific Function Group. Execution Management
              *                      will perform state transition from the current state to
@@ -0,0 +1,118 @@
+/**
+ * \file state_request_channel.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_EXEC_STATE_REQUEST_CHANNEL_H_
+#define ARA_EXEC_STATE_REQUEST_CHANNEL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "ara/core/result.h"
+#include "ara/core/span.h"
+#include "ara/exec/exec_error_domain.h"
+#include "ara/exec/function_group_registry.h"
+#include "ara/exec/state_client.h"
+
+namespace ara
+{
+    namespace exec
+    {
+        /**
+         * \brief Outcome of a state transition requested through a StateRequestChannel.
+         * 
+         */
+        struct StateTransitionCompletion
+        {
+            FunctionGroupStateId state;     /*< The requested state. */
+            std::uint32_t requester;        /*< As passed to Post(), e.g. the index of a supervised entity. */
+            std::uint32_t tag;              /*< As passed to Post(), e.g. the step of a multi-step recovery. */
+            std::uint64_t finishedNs;       /*< CLOCK_MONOTONIC time the transition completed, failed or was
+                                                cancelled. */
+            bool failed;                    /*< true if the transition did not succeed. */
+            ExecErrc error;                 /*< kFailed or kCancelled; only meaningful if failed is true. */
+        };
+
+        /**
+         * \brief Connection to Execution Management for state transition requests on a latency-critical
+         *        path, such as recovery actions of Platform Health Management.
+         * 
+         * StateClient::SetState() returns an ara::core::Future, whose shared state is allocated for every
+         * request. A StateRequestChannel instead sends fixed-size messages that carry the interned
+         * FunctionGroupStateId, so Post() is one send() of a buffer on the stack to the Execution
+         * Management socket (SOCK_SEQPACKET) and neither allocates nor blocks. Execution Management answers
+         * every request with a completion message on the same connection. The owner waits for
+         * GetFileDescriptor() to become readable, e.g. in its epoll set, and collects them with
+         * ReadCompletions(). No thread is started.
+         * 
+         * \note Both ends resolve FunctionGroupStateIds with the FunctionGroupRegistry built from the same
+         *       machine manifest.
+         */
+        class StateRequestChannel
+        {
+            /**
+             * \brief Constructs a channel; nothing is connected yet.
+             * 
+             */
+            StateRequestChannel() noexcept;
+
+            /**
+             * \brief Destructor. Closes the connection; completions of pending requests are lost.
+             * 
+             */
+            ~StateRequestChannel() noexcept;
+
+            /**
+             * \brief Connects to Execution Management, or to the LocalExecutionManager if ARA_EM_SOCKET is
+             *        set.
+             * 
+             * \return ara::core::Result<void>  void, or kCommunicationError if the connection cannot be
+             *                                  opened
+             * 
+             * Not thread-safe
+             */
+            ara::core::Result<void> Open() noexcept;
+
+            /**
+             * \brief Requests a state transition without allocating.
+             * 
+             * \param[in] state         the requested state
+             * \param[in] requester     returned in the completion
+             * \param[in] tag           returned in the completion
+             * \return ara::core::Result<void>  void, or kCommunicationError if the channel is not open or the
+             *                                  socket buffer is full
+             * 
+             * Thread-safe
+             */
+            ara::core::Result<void> Post(FunctionGroupState const &state, std::uint32_t requester, std::uint32_t tag) noexcept;
+
+            /**
+             * \brief Returns the descriptor which is readable while completions are available.
+             * 
+             * \return int  the socket descriptor, -1 if the channel is not open
+             * 
+             * Thread-safe
+             */
+            int GetFileDescriptor() const noexcept;
+
+            /**
+             * \brief Reads the available completions without blocking or allocating.
+             * 
+             * \param[out] completions  buffer to store the completions to
+             * \return std::size_t      the number of completions stored
+             * 
+             * Not thread-safe
+             */
+            std::size_t ReadCompletions(ara::core::Span<StateTransitionCompletion> completions) noexcept;
+        };
+    } // namespace exec
+    
+} // namespace ara
+
+
+#endif // ARA_EXEC_STATE_REQUEST_CHANNEL_H_
@@ -0,0 +1,64 @@
+/**
+ * \file compression.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PER_COMPRESSION_H_
+#define ARA_PER_COMPRESSION_H_
+
+#include <cstdint>
+
+namespace ara
+{
+    namespace per
+    {
+        /**
+         * \brief Defines the block compression applied to stored values and file content.
+         * 
+         */
+        enum class CompressionAlgorithm : uint8_t
+        {
+            kNone = 0,  /*< Data is stored as is. */
+            kLz4 = 1,   /*< LZ4 block format; fast decompression, moderate ratio. */
+            kZstd = 2,  /*< Zstandard; better ratio at a higher compression cost. */
+        };
+
+        /**
+         * \brief Compression and deduplication settings of a storage.
+         * 
+         * Both are transparent to the application: GetValue(), SetValue() and the file accessors always see
+         * the original data. Values and files below thresholdBytes are stored uncompressed, so reading small
+         * keys costs no decompression. Data which does not shrink by at least minSavingPercent is stored
+         * uncompressed as well.
+         * 
+         * With deduplication, every value of at least thresholdBytes is indexed by a 128 bit content hash;
+         * identical values of different keys are stored once and reference counted, and setting a key to a
+         * value already present writes only the reference. The hash only selects a candidate: on a hash hit
+         * the stored value is compared byte by byte with the new one, and only an exact match is shared. A
+         * colliding value with different content is stored separately, so a collision costs space but can
+         * never return another key's value.
+         */
+        struct CompressionConfig
+        {
+            CompressionAlgorithm algorithm = CompressionAlgorithm::kNone;   /*< The compression to apply. */
+            std::uint32_t thresholdBytes = 4096U;                           /*< Minimum size of compressed or
+                                                                                deduplicated data. */
+            std::uint32_t minSavingPercent = 10U;                           /*< Minimum size reduction for
+                                                                                compressed data to be kept. */
+            std::uint32_t blockBytes = 65536U;                              /*< Files are compressed in blocks of
+                                                                                this size, so ReadAt() only
+                                                                                decompresses the blocks it
+                                                                                touches. */
+            bool deduplicate = false;                                       /*< Store identical values once. */
+        };
+    } // namespace per
+    
+} // namespace ara
+
+
+#endif // ARA_PER_COMPRESSION_H_
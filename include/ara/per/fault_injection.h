@@ -0,0 +1,90 @@
+/**
+ * \file fault_injection.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PER_FAULT_INJECTION_H_
+#define ARA_PER_FAULT_INJECTION_H_
+
+// Test support only. The hooks are compiled into the Persistency when it is built with
+// ARA_PER_FAULT_INJECTION defined, and do not exist otherwise.
+
+#ifndef ARA_PER_FAULT_INJECTION
+#error "fault_injection.h requires a Persistency built with ARA_PER_FAULT_INJECTION defined"
+#endif
+
+#include <cstdint>
+#include "ara/core/result.h"
+#include "ara/per/per_error_domain.h"
+
+namespace ara
+{
+    namespace per
+    {
+        /**
+         * \brief Describes where a simulated power cut hits the physical storage of a storage.
+         * 
+         */
+        struct PowerCutPlan
+        {
+            std::uint64_t seed;             /*< Seed of the pseudo random choice of the cut offset, logged so a
+                                                failing run can be repeated. */
+            std::uint64_t minBytes;         /*< The cut happens after at least this many further bytes have
+                                                been written to the storage ... */
+            std::uint64_t maxBytes;         /*< ... and at most this many. minBytes == maxBytes cuts at an
+                                                exact offset. */
+            bool dropUnsyncedData;          /*< Also discard everything written since the last fsync, like the
+                                                page cache is lost on a real power cut. */
+        };
+
+        /**
+         * \brief Outcome of an armed power cut, see DisarmPowerCut().
+         * 
+         */
+        struct PowerCutResult
+        {
+            bool reached;                   /*< true if the cut happened before it was disarmed. */
+            std::uint64_t offset;           /*< Number of bytes written after arming when the cut happened;
+                                                only valid if reached is true, and may be 0. */
+        };
+
+        /**
+         * \brief Arms a simulated power cut for a storage.
+         * 
+         * When the cut offset is reached, the write in progress is torn at that byte, the storage behaves as
+         * if the device disappeared (every further operation returns kPhysicalStorageError), and, with
+         * dropUnsyncedData, the unsynchronized tail is discarded. After closing all handles, the storage
+         * can be recovered with RecoverKeyValueStorage(kvs, report) and checked for consistency.
+         * 
+         * \param[in] storage   The shortName path of a PortPrototype typed by a
+         *                      PersistencyKeyValueDatabaseInterface or PersistencyFileProxyInterface.
+         * \param[in] plan      Where to cut.
+         * \return ara::core::Result<void>  A Result, being empty or containing one of the
+         *                                  errors defined for Persistency in PerErrc.
+         * \note 
+         * \thread safety reentrant
+         */
+        ara::core::Result<void> ArmPowerCut(ara::core::InstanceSpecifier storage, PowerCutPlan const &plan) noexcept;
+
+        /**
+         * \brief Removes an armed power cut and restores normal operation of a storage.
+         * 
+         * \param[in] storage   The shortName path of the storage.
+         * \return ara::core::Result<PowerCutResult>    A Result, containing whether and where the cut
+         *                                              happened, or one of the errors defined for
+         *                                              Persistency in PerErrc.
+         * \note 
+         * \thread safety reentrant
+         */
+        ara::core::Result<PowerCutResult> DisarmPowerCut(ara::core::InstanceSpecifier storage) noexcept;
+    } // namespace per
+    
+} // namespace ara
+
+
+#endif // ARA_PER_FAULT_INJECTION_H_
@@ -12,6 +12,11 @@
 #define ARA_PER_FILE_STORAGE_H_
 
 #include "ara/core/result.h"
+#include "ara/core/string.h"
+#include "ara/core/vector.h"
+#include "ara/per/compression.h"
+#include "ara/per/read_accessor.h"
+#include "ara/per/read_write_accessor.h"
 
 namespace ara
 {
@@ -29,6 +34,146 @@ namespace ara
          * \thread safety reentrant
          */
         ara::core::Result<SharedHandle<FileStorage>> OpenFileStorage(ara::core::InstanceSpecifier fs) noexcept;
+
+        /**
+         * \brief Opens a file storage which compresses and deduplicates its files.
+         * 
+         * Files are compressed in blocks of CompressionConfig::blockBytes when they are synchronized with
+         * SyncToFile(). With deduplication, files with identical content are stored once.
+         * 
+         * \param[in] fs            The shortName path of a PortPrototype typed by a
+         *                          PersistencyFileProxyInterface.
+         * \param[in] compression   The compression and deduplication settings.
+         * \return ara::core::Result<SharedHandle<FileStorage>>     A Result, containing a SharedHandle, or one of the
+         *                                                          errors defined for Persistency in PerErrc.
+         * \note The settings apply to files written afterwards; existing files keep their encoding.
+         * \thread safety reentrant
+         */
+        ara::core::Result<SharedHandle<FileStorage>> OpenFileStorage(ara::core::InstanceSpecifier fs, CompressionConfig const &compression) noexcept;
+
+        /**
+         * \brief The file storage contains a set of files identified by their names.
+         * 
+         * Every Open method returns an independent accessor with its own current position, so several
+         * threads can each stream through the same file. Files which are only read can additionally be
+         * mapped into memory with MapFileReadOnly().
+         * 
+         * \note 
+         */
+        class FileStorage
+        {
+            /**
+             * \brief The copy constructor for FileStorage shall not be used.
+             * 
+             * \note 
+             */
+            FileStorage(const FileStorage &) = delete;
+
+            /**
+             * \brief The copy assignment operator for FileStorage shall not be used.
+             * 
+             * \return FileStorage&
+             * \note 
+             */
+            FileStorage& operator=(const FileStorage &) = delete;
+
+            /**
+             * \brief Destructor for FileStorage.
+             * 
+             * \note Accessors and mappings opened from this FileStorage stay usable.
+             * \thread safety no
+             */
+            ~FileStorage() noexcept;
+
+            /**
+             * \brief Returns a list of all currently available files of the FileStorage.
+             * 
+             * \return ara::core::Result<ara::core::Vector<ara::core::String>>  A Result, containing a list of file names, or
+             *                                                                  one of the errors defined for Persistency in
+             *                                                                  PerErrc.
+             * \note 
+             * \thread safety reentrant
+             */
+            ara::core::Result<ara::core::Vector<ara::core::String>> GetAllFileNames() const noexcept;
+
+            /**
+             * \brief Checks if a file exists in the FileStorage.
+             * 
+             * \param[in] fileName  The name of the file.
+             * \return ara::core::Result<bool>  A Result, containing true if the file exists, or one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety reentrant
+             */
+            ara::core::Result<bool> FileExists(ara::core::StringView fileName) const noexcept;
+
+            /**
+             * \brief Deletes a file from the FileStorage.
+             * 
+             * \param[in] fileName  The name of the file.
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety reentrant
+             */
+            ara::core::Result<void> DeleteFile(ara::core::StringView fileName) noexcept;
+
+            /**
+             * \brief Returns the size of a file in bytes.
+             * 
+             * \param[in] fileName  The name of the file.
+             * \return ara::core::Result<uint64_t>  A Result, containing the size, or one of the
+             *                                      errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety reentrant
+             */
+            ara::core::Result<uint64_t> GetCurrentFileSize(ara::core::StringView fileName) const noexcept;
+
+            /**
+             * \brief Opens a file for reading and writing. The file is created if it does not exist.
+             * 
+             * \param[in] fileName  The name of the file.
+             * \return ara::core::Result<UniqueHandle<ReadWriteAccessor>>   A Result, containing the accessor, or one of
+             *                                                              the errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety reentrant
+             */
+            ara::core::Result<UniqueHandle<ReadWriteAccessor>> OpenFileReadWrite(ara::core::StringView fileName) noexcept;
+
+            /**
+             * \brief Opens an existing file for reading.
+             * 
+             * \param[in] fileName  The name of the file.
+             * \return ara::core::Result<UniqueHandle<ReadAccessor>>    A Result, containing the accessor, or one of
+             *                                                          the errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety reentrant
+             */
+            ara::core::Result<UniqueHandle<ReadAccessor>> OpenFileReadOnly(ara::core::StringView fileName) noexcept;
+
+            /**
+             * \brief Opens a file for writing, truncating it. The file is created if it does not exist.
+             * 
+             * \param[in] fileName  The name of the file.
+             * \return ara::core::Result<UniqueHandle<ReadWriteAccessor>>   A Result, containing the accessor, or one of
+             *                                                              the errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety reentrant
+             */
+            ara::core::Result<UniqueHandle<ReadWriteAccessor>> OpenFileWriteOnly(ara::core::StringView fileName) noexcept;
+
+            /**
+             * \brief Maps an existing file read-only into memory.
+             * 
+             * \param[in] fileName  The name of the file.
+             * \return ara::core::Result<UniqueHandle<MappedFile>>  A Result, containing the mapping, or one of
+             *                                                      the errors defined for Persistency in PerErrc.
+             * \note Encrypted files cannot be mapped, kEncryptionError is returned for them. Compressed files
+             *       are decompressed into an anonymous mapping first.
+             * \thread safety reentrant
+             */
+            ara::core::Result<UniqueHandle<MappedFile>> MapFileReadOnly(ara::core::StringView fileName) noexcept;
+        };
     } // namespace per
     
 } // namespace ara
@@ -0,0 +1,82 @@
+/**
+ * \file io_backend.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PER_IO_BACKEND_H_
+#define ARA_PER_IO_BACKEND_H_
+
+#include <cstdint>
+#include "ara/core/result.h"
+#include "ara/per/per_error_domain.h"
+
+namespace ara
+{
+    namespace per
+    {
+        /**
+         * \brief Defines how the asynchronous Persistency operations (the ...Async() methods) are executed.
+         * 
+         */
+        enum class IoBackendType : uint8_t
+        {
+            kBlocking = 0,      /*< The operation is executed in the calling thread; the returned Future is
+                                    already ready. */
+            kThreadPool = 1,    /*< The operation is executed by a pool of I/O threads. */
+            kIoUring = 2,       /*< The operation is submitted to a Linux io_uring and completed by a
+                                    completion thread. Falls back to kThreadPool when io_uring is not
+                                    available. */
+        };
+
+        /**
+         * \brief Configuration of the I/O backend of the Persistency.
+         * 
+         */
+        struct IoBackendConfig
+        {
+            IoBackendType type = IoBackendType::kThreadPool;    /*< The requested backend. */
+            std::uint32_t threadCount = 2U;                     /*< Number of I/O threads (kThreadPool), or of
+                                                                    completion threads (kIoUring). */
+            std::uint32_t queueDepth = 256U;                    /*< Maximum number of operations in flight;
+                                                                    further requests wait for a free slot. */
+            std::uint32_t maxBatchSize = 32U;                   /*< Maximum number of queued operations handed to
+                                                                    the kernel with one system call
+                                                                    (io_uring_enter()). */
+        };
+
+        /**
+         * \brief Selects the I/O backend of the Persistency.
+         * 
+         * Operations requested while a batch is being submitted are queued and submitted together with the
+         * next batch, so under load a single system call carries up to maxBatchSize reads, writes and
+         * fsyncs. A SyncToStorageAsync() is submitted as linked writes followed by one fsync.
+         * 
+         * \param[in] config    The backend configuration.
+         * \return ara::core::Result<void>  A Result, being empty or containing one of the
+         *                                  errors defined for Persistency in PerErrc.
+         * \note Shall be called after ara::core::Initialize() and before any storage is opened, otherwise
+         *       kResourceBusyError is returned.
+         * \thread safety no
+         */
+        ara::core::Result<void> SetIoBackend(IoBackendConfig const &config) noexcept;
+
+        /**
+         * \brief Returns the backend which is actually in use.
+         * 
+         * \return IoBackendType    The backend in use, which differs from the requested one if
+         *                          io_uring was not available.
+         * \note 
+         * \thread safety reentrant
+         */
+        IoBackendType GetIoBackend() noexcept;
+    } // namespace per
+    
+} // namespace ara
+
+
+#endif // ARA_PER_IO_BACKEND_H_
@@ -0,0 +1,129 @@
+/**
+ * \file journal.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PER_JOURNAL_H_
+#define ARA_PER_JOURNAL_H_
+
+#include <cstdint>
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+
+namespace ara
+{
+    namespace per
+    {
+        /**
+         * \brief Defines the redundancy model used to protect a storage against interrupted writes.
+         * 
+         * The value is taken from the deployment (PersistencyRedundancyHandling) of the storage.
+         */
+        enum class RedundancyMode : uint8_t
+        {
+            kNone = 0,              /*< No redundancy; a torn write can only be detected, not repaired. */
+            kRedundantCopies = 1,   /*< Two copies are written alternately (A/B). Recovery selects the
+                                        newest copy whose CRC is valid. */
+            kWriteAheadJournal = 2, /*< Changes are appended as CRC protected records to a journal
+                                        and folded into the store at checkpoints. */
+        };
+
+        /**
+         * \brief Defines the kind of change described by a journal record.
+         * 
+         */
+        enum class JournalRecordType : uint8_t
+        {
+            kSetValue = 1,      /*< Key and value are stored in the payload. */
+            kRemoveKey = 2,     /*< Only the key is stored in the payload. */
+            kRemoveAllKey = 3,  /*< The payload is empty. */
+            kCommit = 4,        /*< Closes the records written by one SyncToStorage(). Records which are
+                                    not followed by a valid commit are discarded on recovery. */
+            kCheckpoint = 5,    /*< All records up to this one are contained in the store. */
+        };
+
+        /**
+         * \brief On-storage header preceding every journal record.
+         * 
+         * The header is followed by keyLength bytes of key and valueLength bytes of serialized value. The
+         * crc covers every byte after the crc field up to the end of the payload, and is computed with
+         * Crc32c(). Records are appended only, so after an unclean shutdown at most the records following
+         * the last commit can be torn.
+         * 
+         * \note The layout is fixed, little-endian and 8 byte aligned, independent of the platform.
+         */
+        struct JournalRecordHeader
+        {
+            std::uint32_t magic;        /*< kJournalRecordMagic, used to resynchronize after a torn record. */
+            std::uint32_t crc;          /*< CRC32C over the rest of the header and the payload. */
+            std::uint64_t sequence;     /*< Monotonically increasing record number. */
+            std::uint32_t keyLength;    /*< Length of the key in bytes. */
+            std::uint32_t valueLength;  /*< Length of the serialized value in bytes. */
+            JournalRecordType type;     /*< Kind of change. */
+            std::uint8_t reserved[7];   /*< Shall be written as zero. */
+        };
+
+        /**
+         * \brief Magic number at the start of every JournalRecordHeader ("ARAJ").
+         * 
+         */
+        constexpr std::uint32_t kJournalRecordMagic = 0x4A415241U;
+
+        /**
+         * \brief Superblock written in two alternating slots at the start of the journal.
+         * 
+         * It records where the last checkpoint ended, so recovery starts scanning at checkpointOffset
+         * instead of at the start of the journal. The slot with the higher generation and a valid crc wins.
+         * 
+         */
+        struct JournalSuperblock
+        {
+            std::uint32_t magic;            /*< kJournalRecordMagic. */
+            std::uint32_t crc;              /*< CRC32C over the rest of the superblock. */
+            std::uint64_t generation;       /*< Incremented with every superblock write. */
+            std::uint64_t checkpointSequence;/*< Sequence number of the last checkpoint record. */
+            std::uint64_t checkpointOffset; /*< Journal offset directly behind the last checkpoint record. */
+        };
+
+        /**
+         * \brief Outcome of a recovery run, see RecoverKeyValueStorage().
+         * 
+         */
+        struct RecoveryReport
+        {
+            std::uint64_t recordsScanned;   /*< Journal records read behind the last checkpoint. */
+            std::uint64_t recordsSalvaged;  /*< Records with a valid crc and commit which were applied. */
+            std::uint64_t recordsDiscarded; /*< Torn, corrupted or uncommitted records which were dropped. */
+            std::uint64_t bytesScanned;     /*< Journal bytes read during recovery. */
+            std::uint64_t bytesTruncated;   /*< Bytes cut off the journal tail. */
+            bool usedRedundantCopy;         /*< true if the primary copy was invalid and the redundant
+                                                copy was restored (RedundancyMode::kRedundantCopies). */
+            std::uint64_t durationNanoseconds;/*< Wall time the recovery took. */
+        };
+
+        /**
+         * \brief Computes a CRC32C (Castagnoli, polynomial 0x1EDC6F41) checksum.
+         * 
+         * The implementation selects at startup the fastest available kernel: the SSE4.2 crc32 instruction
+         * on x86-64, the ARMv8 CRC32C instructions on AArch64, and a slicing-by-8 table lookup otherwise.
+         * All kernels produce the same result.
+         * 
+         * \param[in] data  The bytes to checksum.
+         * \param[in] crc   The checksum of the preceding bytes, to checksum data in several
+         *                  parts. 0 for the first part.
+         * \return std::uint32_t    The checksum of the preceding bytes and data.
+         * \note 
+         * \thread safety reentrant
+         */
+        std::uint32_t Crc32c(ara::core::Span<ara::core::Byte const> data, std::uint32_t crc = 0U) noexcept;
+    } // namespace per
+    
+} // namespace ara
+
+
+#endif // ARA_PER_JOURNAL_H_
@@ -11,7 +11,13 @@
 #ifndef ARA_PER_KEY_VALUE_STORAGE_H_
 #define ARA_PER_KEY_VALUE_STORAGE_H_
 
+#include "ara/core/future.h"
 #include "ara/core/result.h"
+#include "ara/per/io_backend.h"
+#include "ara/per/journal.h"
+#include "ara/per/key_value_storage_config.h"
+#include "ara/per/per_error_domain.h"
+#include "ara/per/shared_key_value_storage.h"
 
 namespace ara
 {
@@ -30,6 +36,20 @@ namespace ara
          */
         ara::core::Result<SharedHandle<KeyValueStorage>> OpenKeyValueStorage(ara::core::InstanceSpecifier kvs) noexcept;
 
+        /**
+         * \brief Opens a key-value storage with a configuration overriding the deployed defaults.
+         * 
+         * \param[in] kvs       The shortName path of a PortPrototype typed by a
+         *                      PersistencyKeyValueDatabaseInterface.
+         * \param[in] config    The quota and compaction settings to use.
+         * \return ara::core::Result<SharedHandle<KeyValueStorage>>     A Result, containing a SharedHandle, or one of the
+         *                                                              errors defined for Persistency in PerErrc.
+         * \note When the storage is already open in this process, config shall be equal to the configuration
+         *       it was opened with, otherwise kResourceBusyError is returned.
+         * \thread safety reentrant
+         */
+        ara::core::Result<SharedHandle<KeyValueStorage>> OpenKeyValueStorage(ara::core::InstanceSpecifier kvs, KeyValueStorageConfig const &config) noexcept;
+
         // SWS_PER_00333
         /**
          * \brief Recover an instance of KeyValueStorage.
@@ -49,6 +69,24 @@ namespace ara
          */
         ara::core::Result<void> RecoverKeyValueStorage(ara::core::InstanceSpecifier kvs) noexcept;
 
+        /**
+         * \brief Recover an instance of KeyValueStorage and report what was salvaged.
+         * 
+         * Behaves like RecoverKeyValueStorage(kvs), using the RedundancyMode deployed for the storage:
+         * with kWriteAheadJournal, only the journal behind the last checkpoint is scanned. Records are
+         * replayed up to the last commit whose records all carry a valid CRC32C, and the remaining tail is
+         * truncated. With kRedundantCopies, the newest copy with a valid CRC32C is restored.
+         * 
+         * \param[in] kvs       The shortName path of a PortPrototype typed by a
+         *                      PersistencyKeyValueDatabaseInterface.
+         * \param[out] report   Filled with the number of salvaged and discarded records.
+         * \return ara::core::Result<void>  A Result, being either empty or containing one of
+         *                                  the errors defined for Persistency in PerErrc.
+         * \note OpenKeyValueStorage() performs the same tail replay implicitly after an unclean shutdown.
+         * \thread safety reentrant
+         */
+        ara::core::Result<void> RecoverKeyValueStorage(ara::core::InstanceSpecifier kvs, RecoveryReport &report) noexcept;
+
         // SWS_PER_0033
         /**
          * \brief Reset an instance of KeyValueStorage to the initial state.
@@ -74,17 +112,167 @@ namespace ara
          *                  PersistencyKeyValueDatabaseInterface.
          * \return ara::core::Result<uint64_t>  A Result, containing the occupied space in bytes, or
          *                                      one of the errors defined for Persistency in PerErrc.
-         * \note 
+         * \note The value is the sum of the live and dead byte counters of the storage, which are kept up to
+         *       date incrementally, so the call is O(1) and does not access the physical storage.
          * \thread safety reentrant
          */
         ara::core::Result<uint64_t> GetCurrentKeyValueStorageSize(ara::core::InstanceSpecifier kvs) noexcept;
-        
+
+        /**
+         * \brief Returns the live and dead bytes of a Key-Value Storage and its quota.
+         * 
+         * \param[in] kvs   The shortName path of a PortPrototype typed by a
+         *                  PersistencyKeyValueDatabaseInterface.
+         * \return ara::core::Result<KeyValueStorageSizeInfo>  A Result, containing the size breakdown, or one
+         *                                                     of the errors defined for Persistency in PerErrc.
+         * \note O(1), see GetCurrentKeyValueStorageSize().
+         * \thread safety reentrant
+         */
+        ara::core::Result<KeyValueStorageSizeInfo> GetKeyValueStorageSizeInfo(ara::core::InstanceSpecifier kvs) noexcept;
+
+        /**
+         * \brief Rewrites a Key-Value Storage so that it only contains live records.
+         * 
+         * Compaction runs automatically in the background when the dead bytes exceed the share configured
+         * in KeyValueStorageConfig::compactionDeadPercent. This method triggers it explicitly and returns
+         * when it is finished. The storage stays usable during compaction; records written meanwhile are
+         * carried over.
+         * 
+         * \param[in] kvs   The shortName path of a PortPrototype typed by a
+         *                  PersistencyKeyValueDatabaseInterface.
+         * \return ara::core::Result<void>  A Result, being either empty or containing one of
+         *                                  the errors defined for Persistency in PerErrc.
+         * \note 
+         * \thread safety reentrant
+         */
+        ara::core::Result<void> CompactKeyValueStorage(ara::core::InstanceSpecifier kvs) noexcept;
+
+        /**
+         * \brief Identifies a subscription created with KeyValueStorage::Subscribe().
+         * 
+         */
+        using SubscriptionHandle = std::uint64_t;
+
+        /**
+         * \brief Forward cursor over the ordered key index of a KeyValueStorage.
+         * 
+         * The keys of a KeyValueStorage are kept in a sorted index (ordered by byte-wise comparison), so
+         * a cursor can be positioned on the first key not lower than a given key or prefix and then be
+         * advanced in ascending order. The cursor works on a snapshot of the index taken when it was
+         * opened; keys set or removed afterwards are not visible to it.
+         * 
+         * No key is copied: Key() returns a view into the index snapshot.
+         * 
+         * \note The StringView returned by Key() is valid until the next call to Seek() or Next(), or until
+         *       the cursor is destroyed, whichever comes first.
+         */
+        class KeyCursor
+        {
+            /**
+             * \brief Move constructor for KeyCursor.
+             * 
+             * \param[in] cursor    The KeyCursor object to be moved.
+             * \note 
+             * \thread safety reentrant
+             */
+            KeyCursor(KeyCursor &&cursor) noexcept;
+
+            /**
+             * \brief The copy constructor for KeyCursor shall not be used.
+             * 
+             * \note 
+             */
+            KeyCursor(const KeyCursor &) = delete;
+
+            /**
+             * \brief Move assignment operator for KeyCursor.
+             * 
+             * \param[in] cursor    The KeyCursor object to be moved.
+             * \return KeyCursor&   The moved KeyCursor object.
+             * \note 
+             * \thread safety reentrant
+             */
+            KeyCursor& operator=(KeyCursor &&cursor) & noexcept;
+
+            /**
+             * \brief The copy assignment operator for KeyCursor shall not be used.
+             * 
+             * \return KeyCursor&
+             * \note 
+             */
+            KeyCursor& operator=(const KeyCursor &) = delete;
+
+            /**
+             * \brief Destructor for KeyCursor. Releases the index snapshot.
+             * 
+             * \note 
+             * \thread safety no
+             */
+            ~KeyCursor() noexcept;
+
+            /**
+             * \brief Positions the cursor on the first key which is not lower than the given key.
+             * 
+             * Passing a prefix positions the cursor on the first key starting with that prefix, if any. Passing
+             * an empty StringView positions the cursor on the lowest key. The lookup is a binary search in
+             * the ordered index, i.e. O(log n) in the number of keys.
+             * 
+             * \param[in] key   The key or key prefix to seek to.
+             * \return bool     true if the cursor is positioned on a key, false if all keys
+             *                  are lower than the given key.
+             * \note 
+             * \thread safety no
+             */
+            bool Seek(ara::core::StringView key) noexcept;
+
+            /**
+             * \brief Advances the cursor to the next key in ascending order.
+             * 
+             * \return bool     true if the cursor is positioned on a key, false if the end
+             *                  of the index has been reached.
+             * \note 
+             * \thread safety no
+             */
+            bool Next() noexcept;
+
+            /**
+             * \brief Checks whether the cursor is positioned on a key.
+             * 
+             * \return true     if Key() may be called.
+             * \return false    if the cursor is not positioned or past the last key.
+             * \note 
+             * \thread safety reentrant
+             */
+            bool Valid() const noexcept;
+
+            /**
+             * \brief Returns the key the cursor is positioned on.
+             * 
+             * \return ara::core::StringView    A view of the current key. It shall only be called
+             *                                  when Valid() returns true.
+             * \note 
+             * \thread safety reentrant
+             */
+            ara::core::StringView Key() const noexcept;
+        };
+
 
         // SWS_PER_00339
         /**
          * \brief The key-value storage contains a set of keys with associated values. .
          * 
-         * \note 
+         * All methods except the move constructor, the move assignment and the destructor may be called
+         * concurrently on the same instance; callers need no locking of their own. Moving from or
+         * destroying an instance requires that no other thread uses it. RecoverAllFiles() and
+         * ResetAllFiles() do not touch this instance but the file storage they are given, and are only
+         * reentrant. Readers (HasKey(), GetValue(), GetAllKeys(), cursors) never block: they
+         * work on an RCU snapshot of the index, which writers replace atomically and which is reclaimed once
+         * no reader holds it anymore. Writers (SetValue(), RemoveKey()) are serialized per shard, the shard
+         * being chosen by the hash of the key, so writers of different keys rarely contend. RemoveAllKey(),
+         * SyncToStorage() and DiscardPendingChanges() lock all shards for the time needed to capture the
+         * pending changes.
+         * 
+         * \note The number of shards is set with KeyValueStorageConfig::writerShards.
          */
         class KeyValueStorage
         {
@@ -94,7 +282,7 @@ namespace ara
              * 
              * \param[in] kvs   The KeyValueStorage object to be moved.
              * \note 
-             * \thread safety reentrant
+             * \thread safety no
              */
             KeyValueStorage(KeyValueStorage &&kvs) noexcept;
 
@@ -113,7 +301,7 @@ namespace ara
              * \param[in] kvs   The KeyValueStorage object to be moved.
              * \return KeyValueStorage&     The moved KeyValueStorage object.
              * \note 
-             * \thread safety reentrant
+             * \thread safety no
              */
             KeyValueStorage& operator=(KeyValueStorage &&kvs) & noexcept;
 
@@ -142,10 +330,58 @@ namespace ara
              * \return ara::core::Result<ara::core::Vector<ara::core::String>>  A Result, containing a list of available keys, or one of
              *                                                                  the errors defined for Persistency in PerErrc.
              * \note 
-             * \thread safety reentrant
+             * \thread safety thread-safe
              */
             ara::core::Result<ara::core::Vector<ara::core::String>> GetAllKeys() const noexcept;
 
+            /**
+             * \brief Opens a cursor over the ordered key index of the KeyValueStorage.
+             * 
+             * Unlike GetAllKeys(), no key is copied; the cursor is initially not positioned and has to be placed
+             * with KeyCursor::Seek() first.
+             * 
+             * \return ara::core::Result<KeyCursor>     A Result, containing the cursor, or one of the errors
+             *                                          defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety thread-safe
+             */
+            ara::core::Result<KeyCursor> OpenKeyCursor() const noexcept;
+
+            /**
+             * \brief Calls a callable for every key starting with the given prefix, in ascending order.
+             * 
+             * The keys are handed out as views into the ordered index, so no memory is allocated for them.
+             * The iteration stops early when the callable returns false.
+             * 
+             * \tparam F    A callable with the signature bool(ara::core::StringView).
+             * \param[in] prefix    The key prefix to match. An empty prefix matches all keys.
+             * \param[in] callback  The callable invoked for every matching key. The view
+             *                      passed to it is only valid during the call.
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note The callable shall not modify the KeyValueStorage.
+             * \thread safety thread-safe
+             */
+            template<class F>
+            ara::core::Result<void> ForEachKey(ara::core::StringView prefix, F &&callback) const noexcept;
+
+            /**
+             * \brief Calls a callable for every key in the half-open range [first, last), in ascending order.
+             * 
+             * \tparam F    A callable with the signature bool(ara::core::StringView).
+             * \param[in] first     The lowest key of the range (inclusive).
+             * \param[in] last      The end of the range (exclusive). An empty StringView
+             *                      means the range is unbounded.
+             * \param[in] callback  The callable invoked for every key in the range. The
+             *                      iteration stops early when it returns false.
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note The callable shall not modify the KeyValueStorage.
+             * \thread safety thread-safe
+             */
+            template<class F>
+            ara::core::Result<void> ForEachKeyInRange(ara::core::StringView first, ara::core::StringView last, F &&callback) const noexcept;
+
             // SWS_PER_00043
             /**
              * \brief Checks if a key exists in the KeyValueStorage.
@@ -155,7 +391,7 @@ namespace ara
              *                                  or false if it couldn’t, or one of the errors defined for
              *                                  Persistency in PerErrc.
              * \note 
-             * \thread safety reentrant
+             * \thread safety thread-safe
              */
             ara::core::Result<bool> HasKey(ara::core::StringView key) const noexcept;
 
@@ -169,7 +405,7 @@ namespace ara
              *                                  containing one of the errors defined for Persistency
              *                                  in PerErrc.
              * \note 
-             * \thread safety reentrant
+             * \thread safety thread-safe
              */
             template<class T>
             ara::core::Result<T> GetValue(ara::core::StringView key) const noexcept;
@@ -184,8 +420,9 @@ namespace ara
              * \param[in] value The value to store.
              * \return ara::core::Result<void>  A Result, being empty or containing one of the
              *                                  errors defined for Persistency in PerErrc.
-             * \note 
-             * \thread safety reentrant
+             * \note Returns kOutOfStorageSpaceError, leaving the storage unchanged, if the new record would
+             *       exceed the quota of the storage.
+             * \thread safety thread-safe
              */
             template<class T>
             ara::core::Result<void> SetValue(ara::core::StringView key, const T &value) noexcept;
@@ -198,7 +435,7 @@ namespace ara
              * \return ara::core::Result<void>  A Result, being empty or containing one of the
              *                                  errors defined for Persistency in PerErrc.
              * \note 
-             * \thread safety reentrant
+             * \thread safety thread-safe
              */
             ara::core::Result<void> RemoveKey(ara::core::StringView key) noexcept;
 
@@ -209,7 +446,7 @@ namespace ara
              * \return ara::core::Result<void>  A Result, being empty or containing one of the
              *                                  errors defined for Persistency in PerErrc.
              * \note 
-             * \thread safety reentrant
+             * \thread safety thread-safe
              */
             ara::core::Result<void> RemoveAllKey() noexcept;
 
@@ -220,10 +457,23 @@ namespace ara
              * \return ara::core::Result<void>  A Result, being either empty or containing one of
              *                                  the errors defined for Persistency in PerErrc.
              * \note 
-             * \thread safety reentrant
+             * \thread safety thread-safe
              */
             ara::core::Result<void> SyncToStorage() noexcept;
 
+            /**
+             * \brief Triggers flushing of key-value pairs to the physical storage without blocking.
+             * 
+             * The pending changes are captured when the method is called and written by the I/O backend
+             * selected with SetIoBackend(). Changes made afterwards are not part of this flush.
+             * 
+             * \return ara::core::Future<void>  A Future, becoming ready when the changes are durable, or
+             *                                  containing one of the errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety thread-safe
+             */
+            ara::core::Future<void> SyncToStorageAsync() noexcept;
+
             // SWS_PER_00365
             /**
              * \brief Removes all pending changes to the KeyValueStorage since the last call to SyncToStorage() or
@@ -232,10 +482,72 @@ namespace ara
              * \return ara::core::Result<void>  A Result, being either empty or containing one of
              *                                  the errors defined for Persistency in PerErrc.
              * \note 
-             * \thread safety reentrant
+             * \thread safety thread-safe
              */
             ara::core::Result<void> DiscardPendingChanges() noexcept;
 
+            /**
+             * \brief Registers a callable which is notified when a key, or any key with a given prefix, changes.
+             * 
+             * A key counts as changed when SetValue(), RemoveKey(), RemoveAllKey() or DiscardPendingChanges()
+             * modifies it in this process, or when another process has modified it and called SyncToStorage().
+             * 
+             * Notifications are coalesced per key: a key changed several times before its notification is
+             * dispatched is reported once, and the callable then sees the latest value with GetValue().
+             * Changes are recorded without locks (a per-key pending flag and a lock-free queue) and dispatched
+             * on an internal notification thread, never in the context of the modifying call. Changes from
+             * other processes are detected by watching the storage with inotify.
+             * 
+             * \tparam F    A callable with the signature void(ara::core::StringView).
+             * \param[in] keyOrPrefix   The key, or key prefix followed by '*', to observe. "*" observes
+             *                          all keys.
+             * \param[in] callback      The callable receiving the changed key. The view is only
+             *                          valid during the call.
+             * \return ara::core::Result<SubscriptionHandle>    A Result, containing the handle of the
+             *                                                  subscription, or one of the errors defined for
+             *                                                  Persistency in PerErrc.
+             * \note The callable may call GetValue(), but shall not call Unsubscribe() for its own subscription.
+             * \thread safety thread-safe
+             */
+            template<class F>
+            ara::core::Result<SubscriptionHandle> Subscribe(ara::core::StringView keyOrPrefix, F &&callback) noexcept;
+
+            /**
+             * \brief Registers a callable which is notified on a given executor when a key changes.
+             * 
+             * Same as Subscribe(keyOrPrefix, callback), except that each coalesced notification is handed to
+             * executor.Post() instead of being run on the internal notification thread.
+             * 
+             * \tparam F            A callable with the signature void(ara::core::StringView).
+             * \tparam Executor     A type with a member function Post(G&&) accepting a callable G
+             *                      with the signature void().
+             * \param[in] keyOrPrefix   The key, or key prefix followed by '*', to observe.
+             * \param[in] callback      The callable receiving the changed key.
+             * \param[in] executor      The executor the notifications are posted to. It shall
+             *                          outlive the subscription.
+             * \return ara::core::Result<SubscriptionHandle>    A Result, containing the handle of the
+             *                                                  subscription, or one of the errors defined for
+             *                                                  Persistency in PerErrc.
+             * \note 
+             * \thread safety thread-safe
+             */
+            template<class F, class Executor>
+            ara::core::Result<SubscriptionHandle> Subscribe(ara::core::StringView keyOrPrefix, F &&callback, Executor &executor) noexcept;
+
+            /**
+             * \brief Removes a subscription.
+             * 
+             * When the method returns, the callable of the subscription is not running and will not be called
+             * again.
+             * 
+             * \param[in] handle    The handle returned by Subscribe().
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety thread-safe
+             */
+            ara::core::Result<void> Unsubscribe(SubscriptionHandle handle) noexcept;
+
             // SWS_PER_00335
             /**
              * \brief Recover the whole file storage, including all files.
@@ -0,0 +1,65 @@
+/**
+ * \file key_value_storage_config.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PER_KEY_VALUE_STORAGE_CONFIG_H_
+#define ARA_PER_KEY_VALUE_STORAGE_CONFIG_H_
+
+#include <cstdint>
+#include "ara/per/compression.h"
+
+namespace ara
+{
+    namespace per
+    {
+        /**
+         * \brief Tuning of a key-value storage which is not covered by the manifest.
+         * 
+         * A default constructed object keeps the values deployed with the manifest.
+         * 
+         */
+        struct KeyValueStorageConfig
+        {
+            std::uint64_t quotaBytes = 0U;              /*< Upper limit for the occupied space (live and dead bytes).
+                                                            SetValue() is rejected with kOutOfStorageSpaceError
+                                                            instead of exceeding it. 0 means no quota. */
+            std::uint32_t compactionDeadPercent = 50U;  /*< Background compaction starts when dead bytes make up
+                                                            more than this share of the occupied space. 0 disables
+                                                            automatic compaction. */
+            std::uint64_t compactionMinDeadBytes = 65536U;/*< Dead bytes below this value never trigger compaction,
+                                                            so small storages are not rewritten repeatedly. */
+            bool publishToSharedMemory = false;         /*< Publish the storage on every SyncToStorage() to a shared-
+                                                            memory segment, which other processes can open read-only
+                                                            with OpenSharedKeyValueStorage(). Only one process may
+                                                            publish a storage. */
+            CompressionConfig compression;              /*< Compression and deduplication of large values. */
+            std::uint32_t writerShards = 16U;           /*< Number of independently locked writer shards, rounded up
+                                                            to a power of two. */
+        };
+
+        /**
+         * \brief Breakdown of the space occupied by a key-value storage.
+         * 
+         * The counters are maintained incrementally by every SetValue(), RemoveKey() and compaction, so
+         * reading them never touches the physical storage.
+         */
+        struct KeyValueStorageSizeInfo
+        {
+            std::uint64_t liveBytes;    /*< Bytes of the current keys and values, including record overhead. */
+            std::uint64_t deadBytes;    /*< Bytes of overwritten or removed records not yet compacted away. */
+            std::uint64_t logicalBytes; /*< Bytes the live values would occupy without compression and
+                                            deduplication. */
+            std::uint64_t quotaBytes;   /*< The configured quota, 0 if there is none. */
+        };
+    } // namespace per
+    
+} // namespace ara
+
+
+#endif // ARA_PER_KEY_VALUE_STORAGE_CONFIG_H_
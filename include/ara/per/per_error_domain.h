@@ -0,0 +1,139 @@
+/**
+ * \file per_error_domain.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PER_PER_ERROR_DOMAIN_H_
+#define ARA_PER_PER_ERROR_DOMAIN_H_
+
+#include "ara/core/error_domain.h"
+#include "ara/core/error_code.h"
+#include "ara/core/exception.h"
+
+namespace ara
+{
+    namespace per
+    {
+        /**
+         * \brief Defines the error codes for the PerErrorDomain.
+         * 
+         */
+        enum class PerErrc : ara::core::ErrorDomain::CodeType
+        {
+            kStorageLocationNotFoundError = 1,  /*< The requested storage location is not found or not
+                                                    configured in the AUTOSAR model. */
+            kKeyNotFoundError = 2,              /*< The requested key cannot be found in the key-value
+                                                    storage. */
+            kIllegalWriteAccessError = 3,       /*< The storage is configured read-only. */
+            kPhysicalStorageError = 4,          /*< A severe error which might happen during the operation,
+                                                    such as out of memory or writing/reading to the storage
+                                                    return an error. */
+            kIntegrityError = 5,                /*< The integrity of the storage could not be established. */
+            kValidationError = 6,               /*< The validation of redundancy measures failed. */
+            kEncryptionError = 7,               /*< The encryption or decryption failed. */
+            kDataTypeMismatchError = 8,         /*< The provided data type does not match the stored data
+                                                    type. */
+            kInitValueNotAvailableError = 9,    /*< The operation could not be performed because no initial
+                                                    value is available. */
+            kResourceBusyError = 10,            /*< The operation could not be performed because the resource
+                                                    is currently busy. */
+            kInternalError = 11,                /*< An unspecified error occurred in the persistency. */
+            kOutOfMemoryError = 12,             /*< The memory allocation failed. */
+            kFileNotFoundError = 13,            /*< The requested file name cannot be found in the file
+                                                    storage. */
+            kOutOfStorageSpaceError = 14,       /*< The operation would exceed the quota configured for the
+                                                    storage. */
+        };
+
+        /**
+         * \brief Defines a class for exceptions to be thrown by the Persistency.
+         * 
+         */
+        class PerException : public ara::core::Exception
+        {
+            /**
+             * \brief Constructs a new PerException object containing an error code.
+             * 
+             * \param[in] errorCode     The error code.
+             */
+            explicit PerException(ara::core::ErrorCode errorCode) noexcept;
+        };
+
+        /**
+         * \brief Defines a class representing the Persistency error domain.
+         * 
+         * 0x8000’0000’0000’0101ULL
+         * 
+         */
+        class PerErrorDomain final : public ara::core::ErrorDomain
+        {
+            /**
+             * \brief Alias for the error code value enumeration.
+             * 
+             */
+            using Errc = PerErrc;
+
+            /**
+             * \brief Alias for the exception base class.
+             * 
+             */
+            using Exception = PerException;
+
+            /**
+             * \brief Constructs a new PerErrorDomain object.
+             * 
+             */
+            constexpr PerErrorDomain() noexcept;
+
+            /**
+             * \brief Returns a string constant associated with PerErrorDomain.
+             * 
+             * \return char const*  The name of the error domain.
+             */
+            char const* Name() const noexcept override;
+
+            /**
+             * \brief Returns the message associated with errorCode.
+             * 
+             * \param[in] errorCode     The error code number.
+             * 
+             * \return char const*      The message associated with the error code.
+             */
+            char const* Message(ara::core::ErrorDomain::CodeType errorCode) const noexcept override;
+
+            /**
+             * \brief Creates a new instance of PerException from errorCode and throws it as a C++ exception.
+             * 
+             * \param[in] errorCode     The error to throw.
+             */
+            void ThrowAsException(ara::core::ErrorCode const &errorCode) const noexcept(false) override;
+        };
+
+        /**
+         * \brief Returns a reference to the global PerErrorDomain object.
+         * 
+         * \return ara::core::ErrorDomain const&    Return a reference to the global PerErrorDomain
+         *                                          object.
+         */
+        constexpr ara::core::ErrorDomain const& GetPerErrorDomain() noexcept;
+
+        /**
+         * \brief Creates an instance of ErrorCode.
+         * 
+         * \param[in] code  Error code number.
+         * \param[in] data  Vendor defined data associated with the error.
+         * 
+         * \return ara::core::ErrorCode     An ErrorCode object.
+         */
+        constexpr ara::core::ErrorCode MakeErrorCode(PerErrc code, ara::core::ErrorDomain::SupportDataType data) noexcept;
+    } // namespace per
+    
+} // namespace ara
+
+
+#endif // ARA_PER_PER_ERROR_DOMAIN_H_
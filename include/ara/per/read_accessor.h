@@ -0,0 +1,314 @@
+/**
+ * \file read_accessor.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PER_READ_ACCESSOR_H_
+#define ARA_PER_READ_ACCESSOR_H_
+
+#include <cstdint>
+#include "ara/core/future.h"
+#include "ara/core/result.h"
+#include "ara/core/span.h"
+#include "ara/core/string.h"
+#include "ara/core/utility.h"
+#include "ara/per/io_backend.h"
+#include "ara/per/per_error_domain.h"
+
+namespace ara
+{
+    namespace per
+    {
+        /**
+         * \brief Expected access pattern of a file, passed to the operating system as read-ahead hint.
+         * 
+         */
+        enum class AccessPattern : uint8_t
+        {
+            kNormal = 0,        /*< No special treatment. */
+            kSequential = 1,    /*< The file is read from start to end; read-ahead is increased. */
+            kRandom = 2,        /*< The file is read at random offsets; read-ahead is disabled. */
+        };
+
+        /**
+         * \brief ReadAccessor is used to read file data.
+         * 
+         * Reads come in two flavours. The streaming methods (Read(), ReadText(), GetChar(), ...) read at
+         * the current position of the accessor and advance it. The positional method ReadAt() reads at an
+         * explicit offset with pread(), neither using nor changing the current position, so it needs no lock
+         * and may be called by several threads on the same accessor at the same time.
+         * 
+         * \note Several ReadAccessors may be open for the same file at the same time.
+         */
+        class ReadAccessor
+        {
+            /**
+             * \brief Move constructor for ReadAccessor.
+             * 
+             * \param[in] ra    The ReadAccessor object to be moved.
+             * \note 
+             * \thread safety reentrant
+             */
+            ReadAccessor(ReadAccessor &&ra) noexcept;
+
+            /**
+             * \brief The copy constructor for ReadAccessor shall not be used.
+             * 
+             * \note 
+             */
+            ReadAccessor(const ReadAccessor &) = delete;
+
+            /**
+             * \brief Move assignment operator for ReadAccessor.
+             * 
+             * \param[in] ra    The ReadAccessor object to be moved.
+             * \return ReadAccessor&    The moved ReadAccessor object.
+             * \note 
+             * \thread safety reentrant
+             */
+            ReadAccessor& operator=(ReadAccessor &&ra) & noexcept;
+
+            /**
+             * \brief The copy assignment operator for ReadAccessor shall not be used.
+             * 
+             * \return ReadAccessor&
+             * \note 
+             */
+            ReadAccessor& operator=(const ReadAccessor &) = delete;
+
+            /**
+             * \brief Destructor for ReadAccessor. Closes the file.
+             * 
+             * \note 
+             * \thread safety no
+             */
+            virtual ~ReadAccessor() noexcept;
+
+            /**
+             * \brief Returns the character at the current position of the file without advancing it.
+             * 
+             * \return ara::core::Result<char>  A Result, containing the character, or one of the errors
+             *                                  defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<char> PeekChar() const noexcept;
+
+            /**
+             * \brief Returns the character at the current position of the file and advances it by one.
+             * 
+             * \return ara::core::Result<char>  A Result, containing the character, or one of the errors
+             *                                  defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<char> GetChar() noexcept;
+
+            /**
+             * \brief Reads the file from the current position to its end as text.
+             * 
+             * \return ara::core::Result<ara::core::String>     A Result, containing the text, or one of the
+             *                                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<ara::core::String> ReadText() noexcept;
+
+            /**
+             * \brief Reads at most n characters from the current position as text.
+             * 
+             * \param[in] n     The maximum number of characters to read.
+             * \return ara::core::Result<ara::core::String>     A Result, containing the text, or one of the
+             *                                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<ara::core::String> ReadText(uint64_t n) noexcept;
+
+            /**
+             * \brief Reads the rest of the current line, and advances the position behind the line end.
+             * 
+             * \param[in] delimiter     The character ending a line.
+             * \return ara::core::Result<ara::core::String>     A Result, containing the line without the
+             *                                                  delimiter, or one of the errors defined for
+             *                                                  Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<ara::core::String> ReadLine(char const delimiter = '\n') noexcept;
+
+            /**
+             * \brief Reads the next chunk of the file into a caller provided buffer.
+             * 
+             * This is the streaming interface for large files: the file is read in chunks of the buffer size
+             * without allocating, and the position is advanced by the number of bytes read.
+             * 
+             * \param[out] buffer   The buffer to fill.
+             * \return ara::core::Result<uint64_t>  A Result, containing the number of bytes read (0 at the
+             *                                      end of the file), or one of the errors defined for
+             *                                      Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<uint64_t> Read(ara::core::Span<ara::core::Byte> buffer) noexcept;
+
+            /**
+             * \brief Reads from an explicit offset of the file into a caller provided buffer.
+             * 
+             * The current position is neither used nor changed (pread()), so concurrent calls on the same
+             * accessor do not need to be serialized.
+             * 
+             * \param[in] offset    The offset in bytes from the start of the file.
+             * \param[out] buffer   The buffer to fill.
+             * \return ara::core::Result<uint64_t>  A Result, containing the number of bytes read (less than
+             *                                      the buffer size at the end of the file), or one of the
+             *                                      errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety thread-safe
+             */
+            ara::core::Result<uint64_t> ReadAt(uint64_t offset, ara::core::Span<ara::core::Byte> buffer) const noexcept;
+
+            /**
+             * \brief Reads from an explicit offset of the file without blocking.
+             * 
+             * \param[in] offset    The offset in bytes from the start of the file.
+             * \param[out] buffer   The buffer to fill. It shall stay valid until the Future is ready.
+             * \return ara::core::Future<uint64_t>  A Future, containing the number of bytes read, or one
+             *                                      of the errors defined for Persistency in PerErrc.
+             * \note Executed by the I/O backend selected with SetIoBackend().
+             * \thread safety thread-safe
+             */
+            ara::core::Future<uint64_t> ReadAtAsync(uint64_t offset, ara::core::Span<ara::core::Byte> buffer) const noexcept;
+
+            /**
+             * \brief Returns the current position in bytes from the start of the file.
+             * 
+             * \return uint64_t     The current position.
+             * \note 
+             * \thread safety no
+             */
+            uint64_t GetPosition() const noexcept;
+
+            /**
+             * \brief Sets the current position in bytes from the start of the file.
+             * 
+             * \param[in] position  The new position.
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<void> SetPosition(uint64_t position) noexcept;
+
+            /**
+             * \brief Checks whether the current position is at the end of the file.
+             * 
+             * \return true     if the end of the file is reached.
+             * \return false    otherwise.
+             * \note 
+             * \thread safety no
+             */
+            bool IsEof() const noexcept;
+
+            /**
+             * \brief Returns the size of the file in bytes.
+             * 
+             * \return uint64_t     The size of the file.
+             * \note 
+             * \thread safety reentrant
+             */
+            uint64_t GetSize() const noexcept;
+
+            /**
+             * \brief Announces the expected access pattern of the file to the operating system.
+             * 
+             * \param[in] pattern   The expected access pattern.
+             * \note 
+             * \thread safety reentrant
+             */
+            void Advise(AccessPattern pattern) noexcept;
+        };
+
+        /**
+         * \brief Read-only memory mapping of a whole file.
+         * 
+         * Intended for large files which are read many times, like map tiles or model weights: the content
+         * is paged in by the operating system on first access and shared with every other mapping of the
+         * same file, without copying it into process memory.
+         * 
+         * \note The file shall not be modified or truncated while it is mapped.
+         */
+        class MappedFile
+        {
+            /**
+             * \brief Move constructor for MappedFile.
+             * 
+             * \param[in] mf    The MappedFile object to be moved.
+             * \note 
+             * \thread safety reentrant
+             */
+            MappedFile(MappedFile &&mf) noexcept;
+
+            /**
+             * \brief The copy constructor for MappedFile shall not be used.
+             * 
+             * \note 
+             */
+            MappedFile(const MappedFile &) = delete;
+
+            /**
+             * \brief Move assignment operator for MappedFile.
+             * 
+             * \param[in] mf    The MappedFile object to be moved.
+             * \return MappedFile&  The moved MappedFile object.
+             * \note 
+             * \thread safety reentrant
+             */
+            MappedFile& operator=(MappedFile &&mf) & noexcept;
+
+            /**
+             * \brief The copy assignment operator for MappedFile shall not be used.
+             * 
+             * \return MappedFile&
+             * \note 
+             */
+            MappedFile& operator=(const MappedFile &) = delete;
+
+            /**
+             * \brief Destructor for MappedFile. Unmaps the file.
+             * 
+             * \note 
+             * \thread safety no
+             */
+            ~MappedFile() noexcept;
+
+            /**
+             * \brief Returns the mapped content of the file.
+             * 
+             * \return ara::core::Span<ara::core::Byte const>  The content, valid for the lifetime of
+             *                                                  this object.
+             * \note 
+             * \thread safety thread-safe
+             */
+            ara::core::Span<ara::core::Byte const> GetData() const noexcept;
+
+            /**
+             * \brief Announces the expected access pattern of the mapping to the operating system.
+             * 
+             * \param[in] pattern   The expected access pattern.
+             * \note 
+             * \thread safety reentrant
+             */
+            void Advise(AccessPattern pattern) noexcept;
+        };
+    } // namespace per
+    
+} // namespace ara
+
+
+#endif // ARA_PER_READ_ACCESSOR_H_
@@ -0,0 +1,129 @@
+/**
+ * \file read_write_accessor.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PER_READ_WRITE_ACCESSOR_H_
+#define ARA_PER_READ_WRITE_ACCESSOR_H_
+
+#include "ara/per/read_accessor.h"
+
+namespace ara
+{
+    namespace per
+    {
+        /**
+         * \brief ReadWriteAccessor is used to read and write file data.
+         * 
+         * As for reading, writes are available as streaming methods working at the current position and
+         * as the positional method WriteAt() (pwrite()), which may be called concurrently for disjoint
+         * ranges of the file.
+         * 
+         * \note Written data becomes durable with SyncToFile() only.
+         */
+        class ReadWriteAccessor : public ReadAccessor
+        {
+            /**
+             * \brief Flushes written data and the file size to the physical storage (fdatasync()).
+             * 
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety reentrant
+             */
+            ara::core::Result<void> SyncToFile() noexcept;
+
+            /**
+             * \brief Flushes written data to the physical storage without blocking.
+             * 
+             * \return ara::core::Future<void>  A Future, becoming ready when the data is durable, or
+             *                                  containing one of the errors defined for Persistency in PerErrc.
+             * \note Only writes completed before the call are covered.
+             * \thread safety reentrant
+             */
+            ara::core::Future<void> SyncToFileAsync() noexcept;
+
+            /**
+             * \brief Truncates or extends the file to the given size.
+             * 
+             * Extending a file preallocates the space (fallocate()), so later writes into the range cannot
+             * fail for lack of space.
+             * 
+             * \param[in] size  The new size of the file in bytes.
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<void> SetFileSize(uint64_t size) noexcept;
+
+            /**
+             * \brief Writes text at the current position and advances it.
+             * 
+             * \param[in] s     The text to write.
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<void> WriteText(ara::core::StringView s) noexcept;
+
+            /**
+             * \brief Writes a chunk of data at the current position and advances it.
+             * 
+             * \param[in] data  The bytes to write.
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note 
+             * \thread safety no
+             */
+            ara::core::Result<void> Write(ara::core::Span<ara::core::Byte const> data) noexcept;
+
+            /**
+             * \brief Writes a chunk of data at an explicit offset of the file.
+             * 
+             * The current position is neither used nor changed (pwrite()). The file is extended when the
+             * range lies behind its end.
+             * 
+             * \param[in] offset    The offset in bytes from the start of the file.
+             * \param[in] data      The bytes to write.
+             * \return ara::core::Result<void>  A Result, being empty or containing one of the
+             *                                  errors defined for Persistency in PerErrc.
+             * \note Concurrent calls for overlapping ranges leave the overlapping bytes unspecified.
+             * \thread safety thread-safe
+             */
+            ara::core::Result<void> WriteAt(uint64_t offset, ara::core::Span<ara::core::Byte const> data) noexcept;
+
+            /**
+             * \brief Writes a chunk of data at an explicit offset of the file without blocking.
+             * 
+             * \param[in] offset    The offset in bytes from the start of the file.
+             * \param[in] data      The bytes to write. They shall stay valid until the Future is ready.
+             * \return ara::core::Future<void>  A Future, becoming ready when the data is written, or
+             *                                  containing one of the errors defined for Persistency in PerErrc.
+             * \note Executed by the I/O backend selected with SetIoBackend().
+             * \thread safety thread-safe
+             */
+            ara::core::Future<void> WriteAtAsync(uint64_t offset, ara::core::Span<ara::core::Byte const> data) noexcept;
+
+            /**
+             * \brief Writes text at the current position and advances it.
+             * 
+             * \param[in] s     The text to write.
+             * \return ReadWriteAccessor&   *this. Errors are reported by the next call to SyncToFile().
+             * \note 
+             * \thread safety no
+             */
+            ReadWriteAccessor& operator<<(ara::core::StringView s) noexcept;
+        };
+    } // namespace per
+    
+} // namespace ara
+
+
+#endif // ARA_PER_READ_WRITE_ACCESSOR_H_
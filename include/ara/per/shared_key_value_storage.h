@@ -0,0 +1,168 @@
+/**
+ * \file shared_key_value_storage.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PER_SHARED_KEY_VALUE_STORAGE_H_
+#define ARA_PER_SHARED_KEY_VALUE_STORAGE_H_
+
+#include <atomic>
+#include <cstdint>
+#include "ara/core/result.h"
+#include "ara/per/per_error_domain.h"
+
+namespace ara
+{
+    namespace per
+    {
+        /**
+         * \brief Header at the start of the shared-memory segment a KeyValueStorage is published to.
+         * 
+         * The segment consists of this header, a hash index of bucketCount SharedKeyValueEntry objects
+         * (open addressing, linear probing, bucketCount is a power of two) and a data area holding keys
+         * and serialized values.
+         * 
+         * When the data area runs full, the writer publishes a new, larger segment and sets superseded in
+         * the old one; readers notice it on their next lookup and map the new segment.
+         */
+        struct SharedKeyValueHeader
+        {
+            std::uint32_t magic;                    /*< kSharedKeyValueMagic. */
+            std::uint32_t layoutVersion;            /*< Incremented with incompatible layout changes. */
+            std::atomic<std::uint64_t> generation;  /*< Incremented with every SyncToStorage() of the writer. */
+            std::atomic<std::uint32_t> superseded;  /*< Non-zero once a newer segment has been published. */
+            std::uint32_t bucketCount;              /*< Number of entries of the hash index. */
+            std::uint64_t dataOffset;               /*< Offset of the data area from the segment start. */
+            std::uint64_t dataSize;                 /*< Size of the data area in bytes. */
+        };
+
+        /**
+         * \brief Entry of the hash index of a published KeyValueStorage, protected by a seqlock.
+         * 
+         * The writer increments sequence to an odd value, updates the other fields, and increments it to an
+         * even value again (release). A reader loads sequence (acquire), copies the fields and the
+         * referenced value, issues an acquire fence, loads sequence again and retries if the two reads
+         * differ or are odd. The fields are atomics accessed with relaxed ordering, so concurrent reads and
+         * writes are not a data race. A changed value is written to fresh space in the data area first,
+         * and space is never reused within a segment, so readers never see a torn value.
+         * 
+         * A key whose hash computes to 0 is stored with keyHash 1, so 0 only ever marks an empty bucket;
+         * lookups apply the same mapping before probing.
+         * 
+         * \note Entries are cache-line aligned so that updating one entry does not disturb readers of its
+         *       neighbours.
+         */
+        struct alignas(64) SharedKeyValueEntry
+        {
+            std::atomic<std::uint32_t> sequence;    /*< Seqlock counter, odd while the entry is written. */
+            std::atomic<std::uint32_t> keyHash;     /*< Hash of the key, 0 marks an empty bucket. */
+            std::atomic<std::uint64_t> keyOffset;   /*< Offset of the key in the data area. */
+            std::atomic<std::uint32_t> keyLength;   /*< Length of the key in bytes. */
+            std::atomic<std::uint32_t> valueLength; /*< Length of the serialized value in bytes. */
+            std::atomic<std::uint64_t> valueOffset; /*< Offset of the serialized value in the data area. */
+            std::atomic<std::uint32_t> valueType;   /*< Identifies the type the value was stored with. */
+            std::atomic<std::uint32_t> removed;     /*< Non-zero if the key was removed (tombstone). */
+        };
+
+        /**
+         * \brief Magic number at the start of a SharedKeyValueHeader ("ARAS").
+         * 
+         */
+        constexpr std::uint32_t kSharedKeyValueMagic = 0x53415241U;
+
+        /**
+         * \brief Read-only view of a KeyValueStorage which another process publishes in shared memory.
+         * 
+         * Lookups read the shared segment directly: there is no IPC, no parsing and no per-process copy of
+         * the storage. The view reflects the state of the last SyncToStorage() of the publishing process.
+         * 
+         * \note 
+         */
+        class SharedKeyValueStorageReader
+        {
+            /**
+             * \brief The copy constructor for SharedKeyValueStorageReader shall not be used.
+             * 
+             * \note 
+             */
+            SharedKeyValueStorageReader(const SharedKeyValueStorageReader &) = delete;
+
+            /**
+             * \brief The copy assignment operator for SharedKeyValueStorageReader shall not be used.
+             * 
+             * \return SharedKeyValueStorageReader&
+             * \note 
+             */
+            SharedKeyValueStorageReader& operator=(const SharedKeyValueStorageReader &) = delete;
+
+            /**
+             * \brief Destructor for SharedKeyValueStorageReader. Unmaps the segment.
+             * 
+             * \note 
+             * \thread safety no
+             */
+            ~SharedKeyValueStorageReader() noexcept;
+
+            /**
+             * \brief Checks if a key exists in the published KeyValueStorage.
+             * 
+             * \param[in] key   The key that shall be checked.
+             * \return ara::core::Result<bool>  A Result, containing true if the key could be located
+             *                                  or false if it couldn’t, or one of the errors defined for
+             *                                  Persistency in PerErrc.
+             * \note 
+             * \thread safety thread-safe
+             */
+            ara::core::Result<bool> HasKey(ara::core::StringView key) const noexcept;
+
+            /**
+             * \brief Returns the value assigned to a key of the published KeyValueStorage.
+             * 
+             * \tparam T    The type of the value that shall be retrieved.
+             * \param[in] key   The key to look up.
+             * \return ara::core::Result<T>     A Result, being either the retrieved value or
+             *                                  containing one of the errors defined for Persistency
+             *                                  in PerErrc.
+             * \note 
+             * \thread safety thread-safe
+             */
+            template<class T>
+            ara::core::Result<T> GetValue(ara::core::StringView key) const noexcept;
+
+            /**
+             * \brief Returns the number of SyncToStorage() calls the publisher has made visible.
+             * 
+             * Can be polled cheaply to find out whether anything changed since the last look.
+             * 
+             * \return uint64_t     The current generation.
+             * \note 
+             * \thread safety thread-safe
+             */
+            uint64_t GetGeneration() const noexcept;
+        };
+
+        /**
+         * \brief Opens the shared-memory view of a key-value storage published by another process.
+         * 
+         * The publishing process opens the storage with KeyValueStorageConfig::publishToSharedMemory set.
+         * 
+         * \param[in] kvs   The shortName path of a PortPrototype typed by a
+         *                  PersistencyKeyValueDatabaseInterface.
+         * \return ara::core::Result<SharedHandle<SharedKeyValueStorageReader>>     A Result, containing a SharedHandle,
+         *                                                                          or one of the errors defined for
+         *                                                                          Persistency in PerErrc.
+         * \note Returns kStorageLocationNotFoundError while no process publishes the storage.
+         * \thread safety reentrant
+         */
+        ara::core::Result<SharedHandle<SharedKeyValueStorageReader>> OpenSharedKeyValueStorage(ara::core::InstanceSpecifier kvs) noexcept;
+    } // namespace per
+    
+} // namespace ara
+
+
+#endif // ARA_PER_SHARED_KEY_VALUE_STORAGE_H_
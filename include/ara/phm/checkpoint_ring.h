@@ -0,0 +1,68 @@
+/**
+ * \file checkpoint_ring.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PHM_CHECKPOINT_RING_H_
+#define ARA_PHM_CHECKPOINT_RING_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace ara
+{
+    namespace phm
+    {
+        /**
+         * \brief Number of slots of a CheckpointRing, a power of two.
+         * 
+         */
+        constexpr std::uint32_t kCheckpointRingSize = 1024U;
+
+        /**
+         * \brief One reported checkpoint.
+         * 
+         * The writer first stores 0 to sequence followed by a release fence, so a reader can no longer
+         * match the slot, then fills checkpointId and timestampNs, and finally stores the new report number
+         * to sequence with release order. The monitor loads sequence with acquire order, copies the other
+         * fields, issues an acquire fence and loads sequence again; it accepts the slot only if both loads
+         * return the expected report number, so a slot overwritten while it was copied is never accepted.
+         * All fields are atomics and the fields other than sequence are accessed with relaxed order.
+         */
+        struct CheckpointRecord
+        {
+            std::atomic<std::uint64_t> sequence;    /*< Report number of the record, starting at 1; 0 while
+                                                        the slot is written. */
+            std::atomic<std::uint32_t> checkpointId;/*< The reported checkpoint. */
+            std::uint32_t reserved;                 /*< Unused. */
+            std::atomic<std::uint64_t> timestampNs; /*< CLOCK_MONOTONIC time of the report. */
+        };
+
+        /**
+         * \brief Single-producer ring of checkpoint reports of one Supervised Entity, in shared memory
+         *        ("/ara_phm.<entity id>") between the supervised process and the SupervisionMonitor.
+         * 
+         * There is one ring per Supervised Entity, shared by all SupervisedEntity instances created for it.
+         * The process is the only writer: it writes slot (head mod kCheckpointRingSize) and then
+         * increments head. The monitor keeps its own read position and never writes to the ring, so the
+         * supervised process cannot be blocked by it. If the process reports more than kCheckpointRingSize
+         * checkpoints within one supervision cycle, the oldest ones are overwritten; the monitor detects
+         * this from head and reports a failed supervision for that cycle, since deadline and logical
+         * supervision cannot be evaluated over the lost reports.
+         */
+        struct CheckpointRing
+        {
+            alignas(64) std::atomic<std::uint64_t> head;        /*< Number of reports written. */
+            alignas(64) CheckpointRecord records[kCheckpointRingSize];/*< The slots. */
+        };
+    } // namespace phm
+    
+} // namespace ara
+
+
+#endif // ARA_PHM_CHECKPOINT_RING_H_
@@ -0,0 +1,115 @@
+/**
+ * \file health_core.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PHM_HEALTH_CORE_H_
+#define ARA_PHM_HEALTH_CORE_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "ara/core/result.h"
+#include "ara/core/span.h"
+#include "ara/exec/state_request_channel.h"
+#include "ara/phm/recovery_action.h"
+#include "ara/phm/supervision_monitor.h"
+
+namespace ara
+{
+    namespace phm
+    {
+        /**
+         * \brief Event-driven core of Platform Health Management.
+         * 
+         * The core runs one thread, which waits in epoll on two timerfds on CLOCK_MONOTONIC: the periodic
+         * supervision cycle, and a one-shot timer armed to the earliest pending deadline of all deadline
+         * supervisions. Either event makes it run SupervisionMonitor::Evaluate(). Checkpoint reports are
+         * only drained by an evaluation, since ReportCheckpoint() makes no system call to wake the core.
+         * A deadline whose source report was drained by an earlier evaluation is therefore detected when
+         * it expires; a deadline opened and missed within the current cycle is detected at the next cycle
+         * tick. For every entity that turns kExpired, the global status is updated and the bound
+         * RecoveryAction is invoked in the same thread, without allocation or locks. The time from
+         * violation to invocation is thus bounded by the timer wake-up latency plus one evaluation for
+         * deadlines already known to the core, and by one supervision cycle plus that for all others. It
+         * is recorded for every failure.
+         * 
+         * State transitions requested by recovery actions complete asynchronously. The descriptor of the
+         * bound StateRequestChannel is the third source in the epoll set; its completions are read into a
+         * preallocated buffer and handed to RecoveryAction::TransitionCompleted() of the action bound to
+         * the requesting entity, which may post the next step of a multi-step recovery. The finish time is
+         * stored as recoveredNs in the failure record.
+         * 
+         * \note All bindings shall be made before Start().
+         */
+        class HealthCore
+        {
+            /**
+             * \brief Creates the core.
+             * 
+             * \param[in] monitor           the monitor to evaluate; it shall outlive the core
+             * \param[in] supervisionCycle  the period of the supervision cycle
+             */
+            HealthCore(SupervisionMonitor &monitor, std::chrono::nanoseconds supervisionCycle) noexcept;
+
+            /**
+             * \brief Destructor. Stops the core thread.
+             * 
+             */
+            ~HealthCore() noexcept;
+
+            /**
+             * \brief Binds a recovery action to an entity.
+             * 
+             * \param[in] entity    index of the entity in the monitor configuration
+             * \param[in] action    the action, invoked when the entity becomes kExpired; it
+             *                      shall outlive the core
+             * 
+             * Not thread-safe
+             */
+            void BindRecoveryAction(std::uint32_t entity, RecoveryAction &action) noexcept;
+
+            /**
+             * \brief Binds the channel through which recovery actions request state transitions.
+             * 
+             * \param[in] channel   an open channel; it shall outlive the core
+             * 
+             * Not thread-safe
+             */
+            void BindStateRequestChannel(ara::exec::StateRequestChannel &channel) noexcept;
+
+            /**
+             * \brief Starts the core thread.
+             * 
+             * \param[in] fifoPriority  SCHED_FIFO priority of the core thread, 0 keeps the default policy
+             * \return ara::core::Result<void>  void, or an error if the timers or the thread cannot be
+             *                                  created
+             * 
+             * Not thread-safe
+             */
+            ara::core::Result<void> Start(std::int32_t fifoPriority = 0) noexcept;
+
+            /**
+             * \brief Returns the failures handled so far, with their detection timestamps, for latency
+             *        measurements.
+             * 
+             * The records are kept in a preallocated ring of 256 entries; older ones are overwritten.
+             * 
+             * \param[out] failures     buffer to copy the most recent records to, oldest first
+             * \return std::size_t      the number of records copied
+             * 
+             * Thread-safe
+             */
+            std::size_t GetHandledFailures(ara::core::Span<SupervisionFailure> failures) const noexcept;
+        };
+    } // namespace phm
+    
+} // namespace ara
+
+
+#endif // ARA_PHM_HEALTH_CORE_H_
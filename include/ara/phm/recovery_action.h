@@ -0,0 +1,154 @@
+/**
+ * \file recovery_action.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PHM_RECOVERY_ACTION_H_
+#define ARA_PHM_RECOVERY_ACTION_H_
+
+#include <cstdint>
+#include "ara/exec/state_client.h"
+#include "ara/exec/state_request_channel.h"
+#include "ara/phm/supervised_entity.h"
+
+namespace ara
+{
+    namespace phm
+    {
+        /**
+         * \brief Kind of supervision which detected a failure.
+         * 
+         */
+        enum class TypeOfSupervision : uint32_t
+        {
+            kAliveSupervision = 0,      /*< Alive supervision. */
+            kDeadlineSupervision = 1,   /*< Deadline supervision. */
+            kLogicalSupervision = 2,    /*< Logical supervision. */
+        };
+
+        /**
+         * \brief Describes a supervision failure handed to a RecoveryAction.
+         * 
+         */
+        struct SupervisionFailure
+        {
+            std::uint32_t entity;               /*< Index of the failed entity in the monitor configuration. */
+            TypeOfSupervision type;             /*< The failed supervision. */
+            LocalSupervisionStatus status;      /*< Local status after the failure. */
+            GlobalSupervisionStatus global;     /*< Global status after the failure. */
+            std::uint64_t violationNs;          /*< CLOCK_MONOTONIC time the supervision was violated, e.g. the
+                                                    expired deadline. */
+            std::uint64_t detectedNs;           /*< CLOCK_MONOTONIC time the HealthCore detected it. */
+            std::uint64_t recoveredNs;          /*< CLOCK_MONOTONIC time the last state transition requested
+                                                    by the recovery finished, 0 while none has. Only set in
+                                                    the records of HealthCore::GetHandledFailures(). */
+        };
+
+        /**
+         * \brief Action Platform Health Management performs when an entity expires.
+         * 
+         * \note This replaces the R19-11 ara::phm::RecoveryAction, a service skeleton whose
+         *       RecoveryHandler() receives an ara::exec::ExecutionErrorEvent and a TypeOfSupervision over
+         *       ara::com. Here the action is invoked in-process by the HealthCore, so no communication
+         *       stack lies on the latency-critical path. It receives the SupervisionFailure, which
+         *       carries the timestamps for latency accounting.
+         */
+        class RecoveryAction
+        {
+        public:
+            /**
+             * \brief Destructor.
+             * 
+             */
+            virtual ~RecoveryAction() noexcept = default;
+
+            /**
+             * \brief Performs the recovery.
+             * 
+             * Called in the HealthCore thread, right after the failure was detected. The handler is on the
+             * latency-critical path and shall neither block nor allocate memory.
+             * 
+             * \param[in] failure   the failure that triggered the recovery
+             */
+            virtual void RecoveryHandler(SupervisionFailure const &failure) noexcept = 0;
+
+            /**
+             * \brief Called when a state transition this action posted to the StateRequestChannel of the
+             *        HealthCore has finished.
+             * 
+             * Called in the HealthCore thread, outside the latency-critical path. An action consisting of
+             * several transitions posts the next one from here. The default does nothing.
+             * 
+             * \param[in] completion    the outcome of the transition; its requester is the entity of the
+             *                          failure that triggered the recovery
+             */
+            virtual void TransitionCompleted(ara::exec::StateTransitionCompletion const &completion) noexcept
+            {
+                static_cast<void>(completion);
+            }
+        };
+
+        /**
+         * \brief RecoveryAction requesting a Function Group state transition, e.g. to a degraded state, or
+         *        a restart of a process by switching its Function Group to an Off state and back.
+         * 
+         * The FunctionGroupStates are constructed when the action is created. RecoveryHandler() does not
+         * use StateClient::SetState(), whose Future allocates; it posts the first state to the
+         * StateRequestChannel of the HealthCore, with the failed entity as requester and tag 0. That is one
+         * send() of a fixed-size message. For a restart, TransitionCompleted() posts restartState with tag 1
+         * once the completion of tag 0 arrives. If the first transition failed or was cancelled, the second
+         * one is not requested.
+         */
+        class StateTransitionRecovery final : public RecoveryAction
+        {
+        public:
+            /**
+             * \brief Creates the action.
+             * 
+             * \param[in] channel   the channel bound to the HealthCore; it shall outlive the action
+             * \param[in] state     the state to request on recovery
+             */
+            StateTransitionRecovery(ara::exec::StateRequestChannel &channel, ara::exec::FunctionGroupState const &state) noexcept;
+
+            /**
+             * \brief Creates an action restarting a Function Group.
+             * 
+             * \param[in] channel       the channel bound to the HealthCore; it shall outlive the action
+             * \param[in] offState      the state to request on recovery, typically Off
+             * \param[in] restartState  the state to request once offState has been reached
+             */
+            StateTransitionRecovery(ara::exec::StateRequestChannel &channel, ara::exec::FunctionGroupState const &offState, ara::exec::FunctionGroupState const &restartState) noexcept;
+
+            /**
+             * \brief Posts the transition to the configured state, or to offState for a restart.
+             * 
+             * \param[in] failure   the failure that triggered the recovery
+             */
+            void RecoveryHandler(SupervisionFailure const &failure) noexcept override;
+
+            /**
+             * \brief Posts restartState once offState has been reached.
+             * 
+             * \param[in] completion    the outcome of a transition posted by this action
+             */
+            void TransitionCompleted(ara::exec::StateTransitionCompletion const &completion) noexcept override;
+
+            /**
+             * \brief Returns the number of transitions that could not be posted, e.g. because the
+             *        connection to Execution Management was down.
+             * 
+             * \return std::uint64_t    the number of failed Post() calls
+             */
+            std::uint64_t GetPostErrorCount() const noexcept;
+        };
+    } // namespace phm
+    
+} // namespace ara
+
+
+#endif // ARA_PHM_RECOVERY_ACTION_H_
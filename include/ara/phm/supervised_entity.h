@@ -0,0 +1,125 @@
+/**
+ * \file supervised_entity.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PHM_SUPERVISED_ENTITY_H_
+#define ARA_PHM_SUPERVISED_ENTITY_H_
+
+// Base on the AUTOSAR_SWS_PlatformHealthManagement.pdf
+// AUTOSAR AP R19-11
+
+#include <cstdint>
+#include "ara/core/instance_specifier.h"
+#include "ara/core/result.h"
+
+namespace ara
+{
+    namespace phm
+    {
+        /**
+         * \brief Status of the supervision of one Supervised Entity.
+         * 
+         */
+        enum class LocalSupervisionStatus : uint32_t
+        {
+            kOK = 0,            /*< All supervisions of the entity are correct. */
+            kFailed = 1,        /*< A supervision failed, but the number of failed reference cycles is still
+                                    within the tolerance. */
+            kExpired = 2,       /*< A supervision failed beyond the tolerance. */
+            kDeactivated = 3,   /*< The entity is not supervised in the current Function Group state. */
+        };
+
+        /**
+         * \brief Status of the supervision of all Supervised Entities of a Function Group state.
+         * 
+         */
+        enum class GlobalSupervisionStatus : uint32_t
+        {
+            kOK = 0,            /*< All entities are kOK or kDeactivated. */
+            kFailed = 1,        /*< At least one entity is kFailed, none is kExpired. */
+            kExpired = 2,       /*< At least one entity is kExpired; recovery is pending. */
+            kStopped = 3,       /*< Recovery has been triggered. */
+            kDeactivated = 4,   /*< No entity is supervised. */
+        };
+
+        /**
+         * \brief Class representing a Supervised Entity, i.e. a part of a process whose execution is
+         *        supervised by Platform Health Management through checkpoints.
+         * 
+         */
+        class SupervisedEntity
+        {
+            /**
+             * \brief Creation of a SupervisedEntity.
+             * 
+             * Maps the checkpoint ring of the entity (see CheckpointRing), which Platform Health Management
+             * creates for every Supervised Entity of the manifest.
+             * 
+             * \param[in] instance  instance specifier of the Supervised Entity.
+             */
+            explicit SupervisedEntity(ara::core::InstanceSpecifier const &instance);
+
+            /**
+             * \brief Destructor of a SupervisedEntity. Unmaps the checkpoint ring.
+             * 
+             */
+            ~SupervisedEntity() noexcept;
+
+            /**
+             * \brief The copy constructor for SupervisedEntity shall not be used.
+             * 
+             */
+            SupervisedEntity(SupervisedEntity const &) = delete;
+
+            /**
+             * \brief The copy assignment operator for SupervisedEntity shall not be used.
+             * 
+             */
+            SupervisedEntity& operator=(SupervisedEntity const &) = delete;
+
+            /**
+             * \brief Reports an occurrence of a Checkpoint.
+             * 
+             * Writes (checkpointId, CLOCK_MONOTONIC timestamp) into the next slot of the entity's
+             * CheckpointRing and publishes it with one release store; there is no system call, lock or
+             * retry loop, so the call is wait-free and costs a vDSO clock read plus a few stores. All
+             * evaluation happens later in the SupervisionMonitor.
+             * 
+             * \tparam EnumT    enumeration of the checkpoints of the entity, generated from the manifest,
+             *                  with an underlying type convertible to std::uint32_t.
+             * \param[in] checkpointId  the checkpoint that has been reached.
+             * 
+             * \note Shall only be called from one thread at a time per Supervised Entity. All
+             *       SupervisedEntity instances of the same entity write the same "/ara_phm.<entity id>"
+             *       ring, so calls on different instances of one entity shall not overlap either.
+             */
+            template <typename EnumT>
+            void ReportCheckpoint(EnumT checkpointId) const noexcept;
+
+            /**
+             * \brief Returns the status of the supervision of this entity, as last evaluated by the
+             *        SupervisionMonitor.
+             * 
+             * \return ara::core::Result<LocalSupervisionStatus>    the status
+             */
+            ara::core::Result<LocalSupervisionStatus> GetLocalSupervisionStatus() const noexcept;
+
+            /**
+             * \brief Returns the global supervision status of the Function Group state the entity belongs to.
+             * 
+             * \return ara::core::Result<GlobalSupervisionStatus>   the status
+             */
+            ara::core::Result<GlobalSupervisionStatus> GetGlobalSupervisionStatus() const noexcept;
+        };
+    } // namespace phm
+    
+} // namespace ara
+
+
+#endif // ARA_PHM_SUPERVISED_ENTITY_H_
@@ -0,0 +1,147 @@
+/**
+ * \file supervision_monitor.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PHM_SUPERVISION_MONITOR_H_
+#define ARA_PHM_SUPERVISION_MONITOR_H_
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include "ara/core/result.h"
+#include "ara/core/string.h"
+#include "ara/core/vector.h"
+#include "ara/phm/checkpoint_ring.h"
+#include "ara/phm/supervised_entity.h"
+
+namespace ara
+{
+    namespace phm
+    {
+        /**
+         * \brief Alive supervision: a checkpoint shall be reported a number of times per reference cycle.
+         * 
+         */
+        struct AliveSupervisionConfig
+        {
+            std::uint32_t checkpointId;             /*< The alive checkpoint. */
+            std::uint32_t referenceCycles;          /*< Length of the reference cycle, in supervision cycles. */
+            std::uint32_t expectedIndications;      /*< Expected reports per reference cycle. */
+            std::uint32_t minMargin;                /*< Accepted shortfall of reports. */
+            std::uint32_t maxMargin;                /*< Accepted excess of reports. */
+        };
+
+        /**
+         * \brief Deadline supervision: the time between two checkpoints shall lie within a window.
+         * 
+         */
+        struct DeadlineSupervisionConfig
+        {
+            std::uint32_t sourceCheckpointId;       /*< Checkpoint starting the measurement. */
+            std::uint32_t targetCheckpointId;       /*< Checkpoint ending the measurement. */
+            std::chrono::nanoseconds minDeadline;   /*< Earliest accepted target report. */
+            std::chrono::nanoseconds maxDeadline;   /*< Latest accepted target report. A source without
+                                                        target after maxDeadline fails too. */
+        };
+
+        /**
+         * \brief Logical supervision: checkpoints shall be reported along the edges of a graph.
+         * 
+         */
+        struct LogicalSupervisionConfig
+        {
+            ara::core::Vector<std::uint32_t> initialCheckpoints;   /*< Checkpoints which may start the graph. */
+            ara::core::Vector<std::uint32_t> finalCheckpoints;     /*< Checkpoints after which the graph may
+                                                                        start again. */
+            ara::core::Vector<std::pair<std::uint32_t, std::uint32_t>> transitions;/*< Allowed (from, to) pairs. */
+        };
+
+        /**
+         * \brief Supervision configuration of one Supervised Entity, taken from the PHM manifest.
+         * 
+         */
+        struct SupervisedEntityConfig
+        {
+            ara::core::String instance;                                 /*< Instance specifier of the entity. */
+            ara::core::Vector<AliveSupervisionConfig> alive;            /*< Alive supervisions. */
+            ara::core::Vector<DeadlineSupervisionConfig> deadline;      /*< Deadline supervisions. */
+            ara::core::Vector<LogicalSupervisionConfig> logical;        /*< Logical supervisions. */
+            std::uint32_t failedCyclesTolerance;                        /*< Failed reference cycles accepted before
+                                                                            the entity becomes kExpired. */
+        };
+
+        /**
+         * \brief Platform Health Management monitor evaluating all Supervised Entities.
+         * 
+         * The monitor creates one CheckpointRing per entity. Once per supervision cycle, Evaluate() drains
+         * every ring from the monitor's read position to head, in report order, and updates the entity's
+         * alive counters, open deadline measurements and logical supervision state. At the end of each
+         * reference cycle the alive counters are checked against their margins. The local status is then
+         * derived (kOK, kFailed while within failedCyclesTolerance, kExpired beyond it) and published
+         * where SupervisedEntity::GetLocalSupervisionStatus() reads it.
+         * 
+         * The counters and limits of all entities are kept in the structure-of-arrays tables of
+         * supervision_table.h, so the per-cycle checks run as vector compares over all entities at once
+         * instead of per entity.
+         * 
+         * \note Evaluate() does not allocate; all state is sized when the monitor is constructed.
+         */
+        class SupervisionMonitor
+        {
+            /**
+             * \brief Constructs the monitor and creates the checkpoint rings of all entities.
+             * 
+             * \param[in] entities  the supervision configuration of all entities
+             */
+            explicit SupervisionMonitor(ara::core::Vector<SupervisedEntityConfig> entities);
+
+            /**
+             * \brief Destructor. Removes the checkpoint rings.
+             * 
+             */
+            ~SupervisionMonitor() noexcept;
+
+            /**
+             * \brief Evaluates all entities for the supervision cycle ending now.
+             * 
+             * \param[in] now   CLOCK_MONOTONIC time of the end of the supervision cycle, used for
+             *                  deadlines whose target has not been reported yet.
+             * \return GlobalSupervisionStatus  the global status after the evaluation
+             * 
+             * Not thread-safe
+             */
+            GlobalSupervisionStatus Evaluate(std::chrono::nanoseconds now) noexcept;
+
+            /**
+             * \brief Activates or deactivates the supervision of an entity, e.g. on a Function Group state
+             *        change. Reports of a deactivated entity are discarded.
+             * 
+             * \param[in] entity    index of the entity in the configuration
+             * \param[in] active    true to activate
+             * 
+             * Not thread-safe
+             */
+            void SetActive(std::uint32_t entity, bool active) noexcept;
+
+            /**
+             * \brief Returns the local status of an entity after the last Evaluate().
+             * 
+             * \param[in] entity    index of the entity in the configuration
+             * \return LocalSupervisionStatus   the status
+             * 
+             * Not thread-safe
+             */
+            LocalSupervisionStatus GetLocalSupervisionStatus(std::uint32_t entity) const noexcept;
+        };
+    } // namespace phm
+    
+} // namespace ara
+
+
+#endif // ARA_PHM_SUPERVISION_MONITOR_H_
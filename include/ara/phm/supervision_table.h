@@ -0,0 +1,102 @@
+/**
+ * \file supervision_table.h
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ARA_PHM_SUPERVISION_TABLE_H_
+#define ARA_PHM_SUPERVISION_TABLE_H_
+
+#include <cstdint>
+#include "ara/core/span.h"
+#include "ara/phm/supervision_monitor.h"
+
+namespace ara
+{
+    namespace phm
+    {
+        /**
+         * \brief Lane width the columns of the supervision tables are padded to: 16 x 32 bit, i.e. one
+         *        AVX-512 register, two AVX2 registers or four NEON registers.
+         * 
+         */
+        constexpr std::uint32_t kSupervisionLaneWidth = 16U;
+
+        /**
+         * \brief All alive supervisions of all entities, stored as structure of arrays.
+         * 
+         * Row i of every column belongs to the same alive supervision. The columns are 64 byte aligned and
+         * padded to a multiple of kSupervisionLaneWidth rows with rows that never fail, so the evaluation
+         * loops have no remainder handling. Per supervision cycle, the monitor
+         * - adds the drained reports to indications (a scatter by row, the only per-report work),
+         * - decrements cyclesLeft in all rows with vector subtraction,
+         * - for the lanes where cyclesLeft reached 0, compares indications against [minIndications,
+         *   maxIndications] with vector compares, producing one failure bitmask per lane group,
+         * - resets indications and cyclesLeft of those lanes with masked stores.
+         * Only set bits of the failure masks are visited by scalar code.
+         */
+        struct AliveSupervisionTable
+        {
+            ara::core::Span<std::uint32_t> indications;     /*< Reports in the current reference cycle. */
+            ara::core::Span<std::uint32_t> minIndications;  /*< expectedIndications - minMargin, clamped to 0
+                                                                when the table is built if minMargin exceeds
+                                                                expectedIndications. */
+            ara::core::Span<std::uint32_t> maxIndications;  /*< expectedIndications + maxMargin, saturated at
+                                                                the maximum of std::uint32_t. */
+            ara::core::Span<std::uint32_t> cyclesLeft;      /*< Supervision cycles left in the reference cycle. */
+            ara::core::Span<std::uint32_t> referenceCycles; /*< Reload value of cyclesLeft. */
+            ara::core::Span<std::uint32_t> entity;          /*< Index of the entity the row belongs to. */
+        };
+
+        /**
+         * \brief All deadline supervisions of all entities, stored as structure of arrays.
+         * 
+         * Reports set or clear openSinceNs of their row. Pending deadlines which expired without a target
+         * report are found once per supervision cycle with two vector compares over all rows: the failure
+         * mask is (openSinceNs != 0) & (now - openSinceNs > maxDeadlineNs), so idle rows never fail. A source
+         * report with timestamp 0 is stored as 1. Padding rows have openSinceNs 0 and maxDeadlineNs set to
+         * the maximum of std::uint64_t, so they never fail either.
+         */
+        struct DeadlineSupervisionTable
+        {
+            ara::core::Span<std::uint64_t> openSinceNs;     /*< Time of the pending source report, 0 if none. */
+            ara::core::Span<std::uint64_t> minDeadlineNs;   /*< Earliest accepted target report. */
+            ara::core::Span<std::uint64_t> maxDeadlineNs;   /*< Latest accepted target report. */
+            ara::core::Span<std::uint32_t> entity;          /*< Index of the entity the row belongs to. */
+        };
+
+        /**
+         * \brief A logical supervision graph of up to 64 checkpoints, compiled into transition bitmaps.
+         * 
+         * The checkpoints of the graph are renumbered 0..63 at construction. Bit t of allowedNext[f] is set
+         * if the transition f -> t is allowed, so checking a report is a shift and a mask, independent of
+         * the number of edges. Graphs with more than 64 checkpoints are rejected by the monitor.
+         */
+        struct LogicalSupervisionBitmap
+        {
+            std::uint64_t allowedNext[64];  /*< Allowed successors of each checkpoint. */
+            std::uint64_t initialMask;      /*< Checkpoints which may start the graph. */
+            std::uint64_t finalMask;        /*< Checkpoints after which the graph may start again. */
+            std::uint8_t current;           /*< Last reported checkpoint, 0xFF if the graph is not active. */
+            std::uint32_t entity;           /*< Index of the entity the graph belongs to. */
+        };
+
+        /**
+         * \brief Compiles a logical supervision configuration into a transition bitmap.
+         * 
+         * \param[in] config    the logical supervision
+         * \param[in] entity    index of the entity the graph belongs to
+         * \param[out] bitmap   the compiled graph
+         * \return bool         false if the graph has more than 64 checkpoints
+         */
+        bool CompileLogicalSupervision(LogicalSupervisionConfig const &config, std::uint32_t entity, LogicalSupervisionBitmap &bitmap) noexcept;
+    } // namespace phm
+    
+} // namespace ara
+
+
+#endif // ARA_PHM_SUPERVISION_TABLE_H_
@@ -0,0 +1,1251 @@
+/**
+ * \file someip_binding.cpp
+ * \author agent (agent@local)
+ * \brief 
+ * \version 0.1
+ * \date 2026-10-18
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+#include "ara/com/someip/someip_binding.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            static_assert(kFixedSerializedSize<MessageHeader> == kMessageHeaderSize, "MessageHeader is 16 bytes on the wire");
+
+            namespace detail
+            {
+                using Clock = std::chrono::steady_clock;
+
+                constexpr std::uint8_t kProtocolVersion = 1U;
+                constexpr std::uint16_t kEventIdFlag = 0x8000U;
+                constexpr int kListenBacklog = 16;
+
+                /**
+                 * \brief kNetworkBindingFailure with errno, or the return code of an error response, as
+                 *        support data.
+                 * 
+                 */
+                inline ara::core::ErrorCode BindingError(int error) noexcept
+                {
+                    return MakeErrorCode(ComErrc::kNetworkBindingFailure, error);
+                }
+
+                /**
+                 * \brief An IPv4 or IPv6 socket address.
+                 * 
+                 */
+                struct Endpoint
+                {
+                    sockaddr_storage address;   /*< The address, zero-filled beyond length. */
+                    socklen_t length;           /*< The used size of address. */
+
+                    bool operator==(Endpoint const &other) const noexcept
+                    {
+                        return (length == other.length) && (std::memcmp(&address, &other.address, length) == 0);
+                    }
+                };
+
+                /**
+                 * \brief Parses a numeric IPv4 or IPv6 address.
+                 * 
+                 */
+                inline ara::core::Result<Endpoint> MakeEndpoint(ara::core::String const &address, std::uint16_t port) noexcept
+                {
+                    Endpoint endpoint;
+                    std::memset(&endpoint, 0, sizeof(endpoint));
+
+                    auto *const v4 = reinterpret_cast<sockaddr_in *>(&endpoint.address);
+                    if (inet_pton(AF_INET, address.c_str(), &v4->sin_addr) == 1)
+                    {
+                        v4->sin_family = AF_INET;
+                        v4->sin_port = htons(port);
+                        endpoint.length = sizeof(sockaddr_in);
+                        return ara::core::Result<Endpoint>::FromValue(endpoint);
+                    }
+
+                    auto *const v6 = reinterpret_cast<sockaddr_in6 *>(&endpoint.address);
+                    if (inet_pton(AF_INET6, address.c_str(), &v6->sin6_addr) == 1)
+                    {
+                        v6->sin6_family = AF_INET6;
+                        v6->sin6_port = htons(port);
+                        endpoint.length = sizeof(sockaddr_in6);
+                        return ara::core::Result<Endpoint>::FromValue(endpoint);
+                    }
+
+                    return ara::core::Result<Endpoint>::FromError(BindingError(EINVAL));
+                }
+
+                /**
+                 * \brief Returns the port a socket is bound to.
+                 * 
+                 */
+                inline ara::core::Result<std::uint16_t> GetBoundPort(int fd) noexcept
+                {
+                    sockaddr_storage address;
+                    socklen_t length = sizeof(address);
+                    if (getsockname(fd, reinterpret_cast<sockaddr *>(&address), &length) != 0)
+                    {
+                        return ara::core::Result<std::uint16_t>::FromError(BindingError(errno));
+                    }
+                    std::uint16_t const port = (address.ss_family == AF_INET)
+                                                   ? reinterpret_cast<sockaddr_in const *>(&address)->sin_port
+                                                   : reinterpret_cast<sockaddr_in6 const *>(&address)->sin6_port;
+                    return ara::core::Result<std::uint16_t>::FromValue(ntohs(port));
+                }
+
+                /**
+                 * \brief Appends a message to a buffer.
+                 * 
+                 */
+                inline void AppendMessage(ara::core::Vector<ara::core::Byte> &buffer, MessageHeader const &header, ara::core::Span<ara::core::Byte const> payload)
+                {
+                    std::size_t const offset = buffer.size();
+                    buffer.resize(offset + kMessageHeaderSize + payload.size());
+                    Serializer<MessageHeader>::Write(header, buffer.data() + offset);
+                    if (!payload.empty())
+                    {
+                        std::memcpy(buffer.data() + offset + kMessageHeaderSize, payload.data(), payload.size());
+                    }
+                }
+
+                /**
+                 * \brief Makes the header of an outgoing message.
+                 * 
+                 */
+                inline MessageHeader MakeHeader(std::uint16_t serviceId, std::uint16_t methodId, std::uint16_t clientId, std::uint16_t sessionId, MessageType type, std::size_t payloadSize) noexcept
+                {
+                    MessageHeader header;
+                    header.serviceId = serviceId;
+                    header.methodId = methodId;
+                    header.length = static_cast<std::uint32_t>(payloadSize) + kMessageHeaderLengthOffset;
+                    header.clientId = clientId;
+                    header.sessionId = sessionId;
+                    header.protocolVersion = kProtocolVersion;
+                    header.interfaceVersion = 1U;
+                    header.messageType = type;
+                    header.returnCode = static_cast<std::uint8_t>(ReturnCode::kOk);
+                    return header;
+                }
+
+                inline std::uint32_t MakeKey(std::uint16_t serviceId, std::uint16_t id) noexcept
+                {
+                    return (static_cast<std::uint32_t>(serviceId) << 16U) | id;
+                }
+            } // namespace detail
+
+            /**
+             * \brief State of a SomeIpBinding.
+             * 
+             * mSendMutex guards the datagram queues, mTcpMutex the TCP connections and all writes to them,
+             * mHandlerMutex the handlers and subscribers, and mRequestMutex the pending requests. Handlers are
+             * called without any lock held, so they may call back into the binding.
+             * 
+             */
+            class SomeIpBinding::Impl
+            {
+            public:
+                explicit Impl(SomeIpBindingConfig const &config) : mConfig(config)
+                {
+                    if (mConfig.syscallBatchSize == 0U)
+                    {
+                        mConfig.syscallBatchSize = 1U;
+                    }
+                    mConfig.maxDatagramSize = std::max(mConfig.maxDatagramSize, kMessageHeaderSize);
+                }
+
+                ~Impl() noexcept
+                {
+                    if (mThread.joinable())
+                    {
+                        mRunning.store(false);
+                        Wake();
+                        mThread.join();
+                    }
+                    try
+                    {
+                        (void)Flush();
+                    }
+                    catch (std::bad_alloc const &)
+                    {
+                    }
+
+                    for (auto &connection : mConnections)
+                    {
+                        close(connection->fd);
+                    }
+                    for (int fd : {mUdpFd, mTcpFd, mEventFd})
+                    {
+                        if (fd >= 0)
+                        {
+                            close(fd);
+                        }
+                    }
+                }
+
+                ara::core::Result<void> Start() noexcept
+                {
+                    if (mStarted.load())
+                    {
+                        return ara::core::Result<void>::FromValue();
+                    }
+
+                    auto local = detail::MakeEndpoint(mConfig.localAddress, 0U);
+                    if (!local)
+                    {
+                        return ara::core::Result<void>::FromError(local.Error());
+                    }
+                    int const family = local.Value().address.ss_family;
+
+                    mEventFd = eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+                    if (mEventFd < 0)
+                    {
+                        return ara::core::Result<void>::FromError(detail::BindingError(errno));
+                    }
+
+                    if (mConfig.udpEnabled)
+                    {
+                        auto socket = OpenSocket(family, SOCK_DGRAM, mConfig.udpPort);
+                        if (!socket)
+                        {
+                            return ara::core::Result<void>::FromError(socket.Error());
+                        }
+                        mUdpFd = socket.Value();
+                        mReceiveBuffer.resize(mConfig.syscallBatchSize * mConfig.maxDatagramSize);
+                        mReceiveVectors.resize(mConfig.syscallBatchSize);
+                        mReceiveHeaders.resize(mConfig.syscallBatchSize);
+                        mReceiveAddresses.resize(mConfig.syscallBatchSize);
+                    }
+
+                    if (mConfig.tcpEnabled)
+                    {
+                        auto socket = OpenSocket(family, SOCK_STREAM, mConfig.tcpPort);
+                        if (!socket)
+                        {
+                            return ara::core::Result<void>::FromError(socket.Error());
+                        }
+                        mTcpFd = socket.Value();
+                        if (listen(mTcpFd, detail::kListenBacklog) != 0)
+                        {
+                            return ara::core::Result<void>::FromError(detail::BindingError(errno));
+                        }
+                    }
+
+                    mRunning.store(true);
+                    try
+                    {
+                        mThread = std::thread(&Impl::Run, this);
+                    }
+                    catch (std::system_error const &error)
+                    {
+                        mRunning.store(false);
+                        return ara::core::Result<void>::FromError(detail::BindingError(error.code().value()));
+                    }
+                    mStarted.store(true);
+                    return ara::core::Result<void>::FromValue();
+                }
+
+                ara::core::Result<std::uint16_t> GetLocalPort(TransportProtocol protocol) const noexcept
+                {
+                    int const fd = (protocol == TransportProtocol::kUdp) ? mUdpFd : mTcpFd;
+                    if (!mStarted.load() || (fd < 0))
+                    {
+                        return ara::core::Result<std::uint16_t>::FromError(detail::BindingError(0));
+                    }
+                    return detail::GetBoundPort(fd);
+                }
+
+                void SetMethodHandler(std::uint16_t serviceId, std::uint16_t methodId, MethodHandler handler, void *context)
+                {
+                    std::lock_guard<std::mutex> lock(mHandlerMutex);
+                    mMethodHandlers[detail::MakeKey(serviceId, methodId)] = MethodEntry{handler, context};
+                }
+
+                void SetEventHandler(std::uint16_t serviceId, std::uint16_t eventId, EventHandler handler, void *context)
+                {
+                    std::lock_guard<std::mutex> lock(mHandlerMutex);
+                    mEventHandlers[detail::MakeKey(serviceId, eventId & ~detail::kEventIdFlag)] = EventEntry{handler, context};
+                }
+
+                ara::core::Result<void> AddSubscriber(std::uint16_t serviceId, std::uint16_t eventId, ara::core::String const &address, std::uint16_t port, TransportProtocol protocol)
+                {
+                    auto endpoint = detail::MakeEndpoint(address, port);
+                    if (!endpoint)
+                    {
+                        return ara::core::Result<void>::FromError(endpoint.Error());
+                    }
+                    std::lock_guard<std::mutex> lock(mHandlerMutex);
+                    mSubscribers[detail::MakeKey(serviceId, eventId & ~detail::kEventIdFlag)].push_back(Subscriber{endpoint.Value(), protocol});
+                    return ara::core::Result<void>::FromValue();
+                }
+
+                ara::core::Result<void> SendNotification(std::uint16_t serviceId, std::uint16_t eventId, ara::core::Span<ara::core::Byte const> payload)
+                {
+                    if (!mStarted.load())
+                    {
+                        return ara::core::Result<void>::FromError(detail::BindingError(0));
+                    }
+
+                    ara::core::Vector<Subscriber> subscribers;
+                    {
+                        std::lock_guard<std::mutex> lock(mHandlerMutex);
+                        auto const found = mSubscribers.find(detail::MakeKey(serviceId, eventId & ~detail::kEventIdFlag));
+                        if (found == mSubscribers.end())
+                        {
+                            return ara::core::Result<void>::FromValue();
+                        }
+                        subscribers = found->second;
+                    }
+
+                    MessageHeader const header = detail::MakeHeader(serviceId, eventId | detail::kEventIdFlag, 0U, NextSessionId(), MessageType::kNotification, payload.size());
+                    ara::core::Result<void> result = ara::core::Result<void>::FromValue();
+                    for (Subscriber const &subscriber : subscribers)
+                    {
+                        auto sent = Send(subscriber.endpoint, subscriber.protocol, header, payload);
+                        if (!sent && result)
+                        {
+                            result = std::move(sent);
+                        }
+                    }
+                    return result;
+                }
+
+                ara::core::Result<void> SendRequest(std::uint16_t serviceId, std::uint16_t methodId, ara::core::String const &address, std::uint16_t port, TransportProtocol protocol, ara::core::Span<ara::core::Byte const> payload, ResponseHandler handler, void *context)
+                {
+                    if (!mStarted.load())
+                    {
+                        return ara::core::Result<void>::FromError(detail::BindingError(0));
+                    }
+                    auto endpoint = detail::MakeEndpoint(address, port);
+                    if (!endpoint)
+                    {
+                        return ara::core::Result<void>::FromError(endpoint.Error());
+                    }
+
+                    // Registered before sending, since the response may arrive before Send() returns. As all
+                    // requests have the same timeout, the I/O thread only has to recompute its wake-up time
+                    // when the first request becomes pending.
+                    std::uint16_t const sessionId = NextSessionId();
+                    bool wasIdle;
+                    {
+                        std::lock_guard<std::mutex> lock(mRequestMutex);
+                        wasIdle = mRequests.empty();
+                        mRequests[sessionId] = PendingRequest{handler, context, detail::Clock::now() + mConfig.requestTimeout};
+                    }
+                    if (wasIdle)
+                    {
+                        Wake();
+                    }
+
+                    MessageHeader const header = detail::MakeHeader(serviceId, methodId, mConfig.clientId, sessionId, MessageType::kRequest, payload.size());
+                    auto sent = Send(endpoint.Value(), protocol, header, payload);
+                    if (!sent)
+                    {
+                        std::lock_guard<std::mutex> lock(mRequestMutex);
+                        mRequests.erase(sessionId);
+                    }
+                    return sent;
+                }
+
+                ara::core::Result<void> Flush()
+                {
+                    ara::core::Vector<Datagram> datagrams;
+                    {
+                        std::lock_guard<std::mutex> lock(mSendMutex);
+                        datagrams.swap(mReady);
+                        for (Datagram &pending : mPending)
+                        {
+                            datagrams.push_back(std::move(pending));
+                        }
+                        mPending.clear();
+                        mBatchOpen = false;
+                    }
+                    return SendDatagrams(datagrams);
+                }
+
+                SomeIpBindingStatistics GetStatistics() const noexcept
+                {
+                    SomeIpBindingStatistics statistics;
+                    statistics.messagesSent = mMessagesSent.load();
+                    statistics.datagramsSent = mDatagramsSent.load();
+                    statistics.sendCalls = mSendCalls.load();
+                    statistics.messagesReceived = mMessagesReceived.load();
+                    statistics.datagramsReceived = mDatagramsReceived.load();
+                    statistics.receiveCalls = mReceiveCalls.load();
+                    statistics.malformedMessages = mMalformedMessages.load();
+                    return statistics;
+                }
+
+            private:
+                struct MethodEntry
+                {
+                    MethodHandler handler;
+                    void *context;
+                };
+
+                struct EventEntry
+                {
+                    EventHandler handler;
+                    void *context;
+                };
+
+                struct Subscriber
+                {
+                    detail::Endpoint endpoint;
+                    TransportProtocol protocol;
+                };
+
+                struct PendingRequest
+                {
+                    ResponseHandler handler;
+                    void *context;
+                    detail::Clock::time_point deadline;
+                };
+
+                /**
+                 * \brief A UDP datagram of one or more messages to one destination.
+                 * 
+                 */
+                struct Datagram
+                {
+                    detail::Endpoint destination;
+                    ara::core::Vector<ara::core::Byte> data;
+                };
+
+                /**
+                 * \brief A TCP connection; rx is only accessed by the I/O thread.
+                 * 
+                 */
+                struct Connection
+                {
+                    int fd;
+                    detail::Endpoint peer;
+                    bool outgoing;
+                    ara::core::Vector<ara::core::Byte> rx;
+                };
+
+                /**
+                 * \brief The origin of a received message, where its response is sent to.
+                 * 
+                 */
+                struct Origin
+                {
+                    TransportProtocol protocol;
+                    detail::Endpoint endpoint;  /*< For UDP. */
+                    int fd;                     /*< For TCP. */
+                };
+
+                ara::core::Result<int> OpenSocket(int family, int type, std::uint16_t port) noexcept
+                {
+                    auto local = detail::MakeEndpoint(mConfig.localAddress, port);
+                    int const fd = socket(family, type | SOCK_CLOEXEC, 0);
+                    if (fd < 0)
+                    {
+                        return ara::core::Result<int>::FromError(detail::BindingError(errno));
+                    }
+                    int const enable = 1;
+                    if (type == SOCK_STREAM)
+                    {
+                        (void)setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+                    }
+                    if (bind(fd, reinterpret_cast<sockaddr const *>(&local.Value().address), local.Value().length) != 0)
+                    {
+                        int const error = errno;
+                        close(fd);
+                        return ara::core::Result<int>::FromError(detail::BindingError(error));
+                    }
+                    return ara::core::Result<int>::FromValue(fd);
+                }
+
+                std::uint16_t NextSessionId() noexcept
+                {
+                    // Session id 0 means "session handling disabled"; it is skipped on wrap-around.
+                    std::uint16_t id = mSessionId.fetch_add(1U);
+                    while (id == 0U)
+                    {
+                        id = mSessionId.fetch_add(1U);
+                    }
+                    return id;
+                }
+
+                void Wake() noexcept
+                {
+                    std::uint64_t const one = 1U;
+                    (void)write(mEventFd, &one, sizeof(one));
+                }
+
+                ara::core::Result<void> Send(detail::Endpoint const &destination, TransportProtocol protocol, MessageHeader const &header, ara::core::Span<ara::core::Byte const> payload)
+                {
+                    return (protocol == TransportProtocol::kUdp) ? Enqueue(destination, header, payload) : SendTcp(destination, header, payload);
+                }
+
+                /**
+                 * \brief Appends a message to the pending datagram of its destination.
+                 * 
+                 */
+                ara::core::Result<void> Enqueue(detail::Endpoint const &destination, MessageHeader const &header, ara::core::Span<ara::core::Byte const> payload)
+                {
+                    if (mUdpFd < 0)
+                    {
+                        return ara::core::Result<void>::FromError(detail::BindingError(0));
+                    }
+                    if (kMessageHeaderSize + payload.size() > mConfig.maxDatagramSize)
+                    {
+                        return ara::core::Result<void>::FromError(detail::BindingError(EMSGSIZE));
+                    }
+
+                    bool wake = false;
+                    {
+                        std::lock_guard<std::mutex> lock(mSendMutex);
+                        auto pending = std::find_if(mPending.begin(), mPending.end(), [&destination](Datagram const &datagram) {
+                            return datagram.destination == destination;
+                        });
+                        if (pending == mPending.end())
+                        {
+                            mPending.push_back(Datagram{destination, {}});
+                            pending = mPending.end() - 1;
+                            pending->data.reserve(mConfig.maxDatagramSize);
+                        }
+                        else if (pending->data.size() + kMessageHeaderSize + payload.size() > mConfig.maxDatagramSize)
+                        {
+                            mReady.push_back(Datagram{destination, std::move(pending->data)});
+                            pending->data.clear();
+                            pending->data.reserve(mConfig.maxDatagramSize);
+                            wake = (mReady.size() == mConfig.syscallBatchSize);
+                        }
+                        detail::AppendMessage(pending->data, header, payload);
+
+                        if (!mBatchOpen)
+                        {
+                            mBatchOpen = true;
+                            mBatchStart = detail::Clock::now();
+                            wake = true;
+                        }
+                    }
+                    mMessagesSent.fetch_add(1U);
+
+                    if (mConfig.maxBatchDelay.count() == 0)
+                    {
+                        return Flush();
+                    }
+                    if (wake)
+                    {
+                        Wake();
+                    }
+                    return ara::core::Result<void>::FromValue();
+                }
+
+                /**
+                 * \brief Sends datagrams with as few sendmmsg() calls as syscallBatchSize allows.
+                 * 
+                 */
+                ara::core::Result<void> SendDatagrams(ara::core::Vector<Datagram> &datagrams)
+                {
+                    if (datagrams.empty())
+                    {
+                        return ara::core::Result<void>::FromValue();
+                    }
+
+                    std::size_t const batchSize = std::min(datagrams.size(), mConfig.syscallBatchSize);
+                    ara::core::Vector<mmsghdr> headers(batchSize);
+                    ara::core::Vector<iovec> vectors(batchSize);
+                    int error = 0;
+
+                    std::size_t next = 0U;
+                    while (next < datagrams.size())
+                    {
+                        std::size_t const count = std::min(datagrams.size() - next, batchSize);
+                        for (std::size_t i = 0U; i < count; ++i)
+                        {
+                            Datagram &datagram = datagrams[next + i];
+                            vectors[i].iov_base = datagram.data.data();
+                            vectors[i].iov_len = datagram.data.size();
+                            std::memset(&headers[i], 0, sizeof(mmsghdr));
+                            headers[i].msg_hdr.msg_name = &datagram.destination.address;
+                            headers[i].msg_hdr.msg_namelen = datagram.destination.length;
+                            headers[i].msg_hdr.msg_iov = &vectors[i];
+                            headers[i].msg_hdr.msg_iovlen = 1U;
+                        }
+
+                        int const sent = sendmmsg(mUdpFd, headers.data(), static_cast<unsigned int>(count), 0);
+                        if (sent < 0)
+                        {
+                            if (errno == EINTR)
+                            {
+                                continue;
+                            }
+                            // The first datagram of the chunk is rejected; it is dropped so the rest is sent.
+                            error = errno;
+                            next += 1U;
+                            continue;
+                        }
+                        mSendCalls.fetch_add(1U);
+                        mDatagramsSent.fetch_add(static_cast<std::uint64_t>(sent));
+                        next += static_cast<std::size_t>(sent);
+                    }
+
+                    if (error != 0)
+                    {
+                        return ara::core::Result<void>::FromError(detail::BindingError(error));
+                    }
+                    return ara::core::Result<void>::FromValue();
+                }
+
+                /**
+                 * \brief Returns the outgoing connection to a peer, connecting if there is none.
+                 * 
+                 * \note Called with mTcpMutex held.
+                 */
+                ara::core::Result<int> GetConnection(detail::Endpoint const &peer)
+                {
+                    for (auto const &connection : mConnections)
+                    {
+                        if (connection->outgoing && (connection->peer == peer))
+                        {
+                            return ara::core::Result<int>::FromValue(connection->fd);
+                        }
+                    }
+
+                    int const fd = socket(peer.address.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+                    if (fd < 0)
+                    {
+                        return ara::core::Result<int>::FromError(detail::BindingError(errno));
+                    }
+                    if (connect(fd, reinterpret_cast<sockaddr const *>(&peer.address), peer.length) != 0)
+                    {
+                        int const error = errno;
+                        close(fd);
+                        return ara::core::Result<int>::FromError(detail::BindingError(error));
+                    }
+                    int const enable = 1;
+                    (void)setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+                    mConnections.emplace_back(new Connection{fd, peer, true, {}});
+                    Wake();
+                    return ara::core::Result<int>::FromValue(fd);
+                }
+
+                ara::core::Result<void> SendTcp(detail::Endpoint const &destination, MessageHeader const &header, ara::core::Span<ara::core::Byte const> payload)
+                {
+                    if (mTcpFd < 0)
+                    {
+                        return ara::core::Result<void>::FromError(detail::BindingError(0));
+                    }
+                    std::lock_guard<std::mutex> lock(mTcpMutex);
+                    auto fd = GetConnection(destination);
+                    if (!fd)
+                    {
+                        return ara::core::Result<void>::FromError(fd.Error());
+                    }
+                    return WriteTcp(fd.Value(), header, payload);
+                }
+
+                /**
+                 * \brief Writes a message to a connection.
+                 * 
+                 * \note Called with mTcpMutex held, so messages of concurrent writers do not interleave.
+                 */
+                ara::core::Result<void> WriteTcp(int fd, MessageHeader const &header, ara::core::Span<ara::core::Byte const> payload)
+                {
+                    ara::core::Byte buffer[kMessageHeaderSize];
+                    Serializer<MessageHeader>::Write(header, buffer);
+                    iovec vectors[2] = {{buffer, kMessageHeaderSize}, {const_cast<ara::core::Byte *>(payload.data()), payload.size()}};
+                    msghdr message;
+                    std::memset(&message, 0, sizeof(message));
+                    message.msg_iov = vectors;
+                    message.msg_iovlen = 2U;
+
+                    std::size_t remaining = kMessageHeaderSize + payload.size();
+                    while (remaining > 0U)
+                    {
+                        ssize_t const written = sendmsg(fd, &message, MSG_NOSIGNAL);
+                        if (written < 0)
+                        {
+                            if (errno == EINTR)
+                            {
+                                continue;
+                            }
+                            return ara::core::Result<void>::FromError(detail::BindingError(errno));
+                        }
+                        remaining -= static_cast<std::size_t>(written);
+                        std::size_t skip = static_cast<std::size_t>(written);
+                        while ((message.msg_iovlen > 0U) && (skip >= message.msg_iov->iov_len))
+                        {
+                            skip -= message.msg_iov->iov_len;
+                            ++message.msg_iov;
+                            --message.msg_iovlen;
+                        }
+                        if (message.msg_iovlen > 0U)
+                        {
+                            message.msg_iov->iov_base = static_cast<char *>(message.msg_iov->iov_base) + skip;
+                            message.msg_iov->iov_len -= skip;
+                        }
+                    }
+                    mMessagesSent.fetch_add(1U);
+                    return ara::core::Result<void>::FromValue();
+                }
+
+                void Reply(Origin const &origin, MessageHeader const &request, MessageType type, ReturnCode code, ara::core::Span<ara::core::Byte const> payload)
+                {
+                    MessageHeader header = detail::MakeHeader(request.serviceId, request.methodId, request.clientId, request.sessionId, type, payload.size());
+                    header.interfaceVersion = request.interfaceVersion;
+                    header.returnCode = static_cast<std::uint8_t>(code);
+                    if (origin.protocol == TransportProtocol::kUdp)
+                    {
+                        (void)Enqueue(origin.endpoint, header, payload);
+                    }
+                    else
+                    {
+                        std::lock_guard<std::mutex> lock(mTcpMutex);
+                        (void)WriteTcp(origin.fd, header, payload);
+                    }
+                }
+
+                void Dispatch(MessageHeader const &header, ara::core::Span<ara::core::Byte const> payload, Origin const &origin)
+                {
+                    switch (header.messageType)
+                    {
+                    case MessageType::kRequest:
+                    case MessageType::kRequestNoReturn:
+                    {
+                        MethodEntry method{nullptr, nullptr};
+                        {
+                            std::lock_guard<std::mutex> lock(mHandlerMutex);
+                            auto const found = mMethodHandlers.find(detail::MakeKey(header.serviceId, header.methodId));
+                            if (found != mMethodHandlers.end())
+                            {
+                                method = found->second;
+                            }
+                        }
+                        bool const respond = (header.messageType == MessageType::kRequest);
+                        if (method.handler == nullptr)
+                        {
+                            if (respond)
+                            {
+                                Reply(origin, header, MessageType::kError, ReturnCode::kUnknownMethod, {});
+                            }
+                            break;
+                        }
+                        auto response = method.handler(header, payload, method.context);
+                        if (respond)
+                        {
+                            if (response)
+                            {
+                                Reply(origin, header, MessageType::kResponse, ReturnCode::kOk, response.Value());
+                            }
+                            else
+                            {
+                                Reply(origin, header, MessageType::kError, ReturnCode::kNotOk, {});
+                            }
+                        }
+                        break;
+                    }
+                    case MessageType::kNotification:
+                    {
+                        EventEntry event{nullptr, nullptr};
+                        {
+                            std::lock_guard<std::mutex> lock(mHandlerMutex);
+                            auto const found = mEventHandlers.find(detail::MakeKey(header.serviceId, header.methodId & ~detail::kEventIdFlag));
+                            if (found != mEventHandlers.end())
+                            {
+                                event = found->second;
+                            }
+                        }
+                        if (event.handler != nullptr)
+                        {
+                            event.handler(header, payload, event.context);
+                        }
+                        break;
+                    }
+                    case MessageType::kResponse:
+                    case MessageType::kError:
+                    {
+                        if (header.clientId != mConfig.clientId)
+                        {
+                            break;
+                        }
+                        PendingRequest request{nullptr, nullptr, {}};
+                        {
+                            std::lock_guard<std::mutex> lock(mRequestMutex);
+                            auto const found = mRequests.find(header.sessionId);
+                            if (found == mRequests.end())
+                            {
+                                break;
+                            }
+                            request = found->second;
+                            mRequests.erase(found);
+                        }
+                        if (header.messageType == MessageType::kResponse)
+                        {
+                            request.handler(ara::core::Result<ara::core::Vector<ara::core::Byte>>::FromValue(ara::core::Vector<ara::core::Byte>(payload.begin(), payload.end())), request.context);
+                        }
+                        else
+                        {
+                            request.handler(ara::core::Result<ara::core::Vector<ara::core::Byte>>::FromError(detail::BindingError(header.returnCode)), request.context);
+                        }
+                        break;
+                    }
+                    default:
+                        mMalformedMessages.fetch_add(1U);
+                        return;
+                    }
+                }
+
+                /**
+                 * \brief Splits data into messages and dispatches them.
+                 * 
+                 * \return std::size_t  the number of bytes consumed; a trailing incomplete message is left
+                 *                      unconsumed if partial is true and dropped otherwise
+                 */
+                std::size_t ProcessMessages(ara::core::Byte const *data, std::size_t size, Origin const &origin, bool partial)
+                {
+                    std::size_t offset = 0U;
+                    while (offset < size)
+                    {
+                        std::size_t const remaining = size - offset;
+                        MessageHeader header;
+                        if (remaining < kMessageHeaderSize)
+                        {
+                            if (!partial)
+                            {
+                                mMalformedMessages.fetch_add(1U);
+                                offset = size;
+                            }
+                            break;
+                        }
+                        Serializer<MessageHeader>::ReadFixed(data + offset, header);
+                        if (header.length < kMessageHeaderLengthOffset)
+                        {
+                            // The length is the only framing; without it the rest cannot be split.
+                            mMalformedMessages.fetch_add(1U);
+                            offset = size;
+                            break;
+                        }
+                        std::size_t const total = static_cast<std::size_t>(header.length) + kMessageHeaderLengthOffset;
+                        if (total > remaining)
+                        {
+                            if (!partial)
+                            {
+                                mMalformedMessages.fetch_add(1U);
+                                offset = size;
+                            }
+                            break;
+                        }
+
+                        if (header.protocolVersion != detail::kProtocolVersion)
+                        {
+                            mMalformedMessages.fetch_add(1U);
+                        }
+                        else
+                        {
+                            mMessagesReceived.fetch_add(1U);
+                            Dispatch(header, ara::core::Span<ara::core::Byte const>(data + offset + kMessageHeaderSize, total - kMessageHeaderSize), origin);
+                        }
+                        offset += total;
+                    }
+                    return offset;
+                }
+
+                void ReceiveDatagrams()
+                {
+                    std::size_t const slots = mConfig.syscallBatchSize;
+                    for (;;)
+                    {
+                        for (std::size_t i = 0U; i < slots; ++i)
+                        {
+                            mReceiveVectors[i].iov_base = mReceiveBuffer.data() + i * mConfig.maxDatagramSize;
+                            mReceiveVectors[i].iov_len = mConfig.maxDatagramSize;
+                            std::memset(&mReceiveHeaders[i], 0, sizeof(mmsghdr));
+                            mReceiveHeaders[i].msg_hdr.msg_name = &mReceiveAddresses[i];
+                            mReceiveHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+                            mReceiveHeaders[i].msg_hdr.msg_iov = &mReceiveVectors[i];
+                            mReceiveHeaders[i].msg_hdr.msg_iovlen = 1U;
+                        }
+
+                        int const received = recvmmsg(mUdpFd, mReceiveHeaders.data(), static_cast<unsigned int>(slots), MSG_DONTWAIT, nullptr);
+                        if (received <= 0)
+                        {
+                            return;
+                        }
+                        mReceiveCalls.fetch_add(1U);
+                        mDatagramsReceived.fetch_add(static_cast<std::uint64_t>(received));
+
+                        for (int i = 0; i < received; ++i)
+                        {
+                            msghdr const &message = mReceiveHeaders[i].msg_hdr;
+                            if ((message.msg_flags & MSG_TRUNC) != 0)
+                            {
+                                mMalformedMessages.fetch_add(1U);
+                                continue;
+                            }
+                            Origin origin;
+                            std::memset(&origin, 0, sizeof(origin));
+                            origin.protocol = TransportProtocol::kUdp;
+                            std::memcpy(&origin.endpoint.address, &mReceiveAddresses[i], message.msg_namelen);
+                            origin.endpoint.length = message.msg_namelen;
+                            origin.fd = -1;
+                            (void)ProcessMessages(static_cast<ara::core::Byte const *>(message.msg_iov->iov_base), mReceiveHeaders[i].msg_len, origin, false);
+                        }
+
+                        if (static_cast<std::size_t>(received) < slots)
+                        {
+                            return;
+                        }
+                    }
+                }
+
+                void AcceptConnection()
+                {
+                    detail::Endpoint peer;
+                    std::memset(&peer, 0, sizeof(peer));
+                    peer.length = sizeof(peer.address);
+                    int const fd = accept4(mTcpFd, reinterpret_cast<sockaddr *>(&peer.address), &peer.length, SOCK_CLOEXEC);
+                    if (fd < 0)
+                    {
+                        return;
+                    }
+                    int const enable = 1;
+                    (void)setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+                    std::lock_guard<std::mutex> lock(mTcpMutex);
+                    mConnections.emplace_back(new Connection{fd, peer, false, {}});
+                }
+
+                /**
+                 * \brief Reads from a connection; returns false if it is closed.
+                 * 
+                 */
+                bool ReceiveStream(Connection &connection)
+                {
+                    std::size_t const offset = connection.rx.size();
+                    connection.rx.resize(offset + mConfig.maxDatagramSize);
+                    ssize_t const received = recv(connection.fd, connection.rx.data() + offset, mConfig.maxDatagramSize, MSG_DONTWAIT);
+                    if (received <= 0)
+                    {
+                        connection.rx.resize(offset);
+                        return (received < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR));
+                    }
+                    connection.rx.resize(offset + static_cast<std::size_t>(received));
+
+                    Origin origin;
+                    std::memset(&origin, 0, sizeof(origin));
+                    origin.protocol = TransportProtocol::kTcp;
+                    origin.endpoint = connection.peer;
+                    origin.fd = connection.fd;
+                    std::size_t const consumed = ProcessMessages(connection.rx.data(), connection.rx.size(), origin, true);
+                    connection.rx.erase(connection.rx.begin(), connection.rx.begin() + static_cast<std::ptrdiff_t>(consumed));
+                    return true;
+                }
+
+                void CloseConnection(Connection const *connection)
+                {
+                    std::lock_guard<std::mutex> lock(mTcpMutex);
+                    auto const found = std::find_if(mConnections.begin(), mConnections.end(), [connection](std::unique_ptr<Connection> const &c) {
+                        return c.get() == connection;
+                    });
+                    if (found != mConnections.end())
+                    {
+                        close((*found)->fd);
+                        mConnections.erase(found);
+                    }
+                }
+
+                /**
+                 * \brief Fails the requests whose deadline has passed.
+                 * 
+                 */
+                void ExpireRequests(detail::Clock::time_point now)
+                {
+                    ara::core::Vector<PendingRequest> expired;
+                    {
+                        std::lock_guard<std::mutex> lock(mRequestMutex);
+                        for (auto it = mRequests.begin(); it != mRequests.end();)
+                        {
+                            if (it->second.deadline <= now)
+                            {
+                                expired.push_back(it->second);
+                                it = mRequests.erase(it);
+                            }
+                            else
+                            {
+                                ++it;
+                            }
+                        }
+                    }
+                    for (PendingRequest const &request : expired)
+                    {
+                        request.handler(ara::core::Result<ara::core::Vector<ara::core::Byte>>::FromError(detail::BindingError(ETIMEDOUT)), request.context);
+                    }
+                }
+
+                /**
+                 * \brief Returns when the I/O thread has to wake up without incoming data.
+                 * 
+                 */
+                detail::Clock::time_point NextDeadline(detail::Clock::time_point now)
+                {
+                    detail::Clock::time_point deadline = detail::Clock::time_point::max();
+                    {
+                        std::lock_guard<std::mutex> lock(mSendMutex);
+                        if (mReady.size() >= mConfig.syscallBatchSize)
+                        {
+                            return now;
+                        }
+                        if (mBatchOpen)
+                        {
+                            deadline = mBatchStart + mConfig.maxBatchDelay;
+                        }
+                    }
+                    std::lock_guard<std::mutex> lock(mRequestMutex);
+                    for (auto const &request : mRequests)
+                    {
+                        deadline = std::min(deadline, request.second.deadline);
+                    }
+                    return deadline;
+                }
+
+                bool BatchDue(detail::Clock::time_point now)
+                {
+                    std::lock_guard<std::mutex> lock(mSendMutex);
+                    return (mReady.size() >= mConfig.syscallBatchSize) || (mBatchOpen && (now >= mBatchStart + mConfig.maxBatchDelay));
+                }
+
+                void Run()
+                {
+                    ara::core::Vector<pollfd> fds;
+                    ara::core::Vector<Connection *> polled;
+                    while (mRunning.load())
+                    {
+                        fds.clear();
+                        polled.clear();
+                        fds.push_back(pollfd{mEventFd, POLLIN, 0});
+                        if (mUdpFd >= 0)
+                        {
+                            fds.push_back(pollfd{mUdpFd, POLLIN, 0});
+                        }
+                        if (mTcpFd >= 0)
+                        {
+                            fds.push_back(pollfd{mTcpFd, POLLIN, 0});
+                        }
+                        std::size_t const firstConnection = fds.size();
+                        {
+                            std::lock_guard<std::mutex> lock(mTcpMutex);
+                            for (auto const &connection : mConnections)
+                            {
+                                fds.push_back(pollfd{connection->fd, POLLIN, 0});
+                                polled.push_back(connection.get());
+                            }
+                        }
+
+                        detail::Clock::time_point now = detail::Clock::now();
+                        detail::Clock::time_point const deadline = NextDeadline(now);
+                        timespec timeout{0, 0};
+                        timespec *timeoutPointer = nullptr;
+                        if (deadline != detail::Clock::time_point::max())
+                        {
+                            auto const wait = std::chrono::duration_cast<std::chrono::nanoseconds>(std::max(deadline - now, detail::Clock::duration::zero()));
+                            timeout.tv_sec = static_cast<time_t>(wait.count() / 1000000000);
+                            timeout.tv_nsec = static_cast<long>(wait.count() % 1000000000);
+                            timeoutPointer = &timeout;
+                        }
+
+                        if (ppoll(fds.data(), fds.size(), timeoutPointer, nullptr) < 0)
+                        {
+                            if (errno != EINTR)
+                            {
+                                return;
+                            }
+                            continue;
+                        }
+
+                        std::size_t index = 0U;
+                        if ((fds[index++].revents & POLLIN) != 0)
+                        {
+                            std::uint64_t count;
+                            (void)read(mEventFd, &count, sizeof(count));
+                        }
+                        if (mUdpFd >= 0)
+                        {
+                            if ((fds[index++].revents & POLLIN) != 0)
+                            {
+                                ReceiveDatagrams();
+                            }
+                        }
+                        if (mTcpFd >= 0)
+                        {
+                            if ((fds[index++].revents & POLLIN) != 0)
+                            {
+                                AcceptConnection();
+                            }
+                        }
+                        for (std::size_t i = firstConnection; i < fds.size(); ++i)
+                        {
+                            if ((fds[i].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+                            {
+                                Connection *const connection = polled[i - firstConnection];
+                                if (!ReceiveStream(*connection))
+                                {
+                                    CloseConnection(connection);
+                                }
+                            }
+                        }
+
+                        now = detail::Clock::now();
+                        if (BatchDue(now))
+                        {
+                            (void)Flush();
+                        }
+                        ExpireRequests(now);
+                    }
+                }
+
+                SomeIpBindingConfig mConfig;                                /*< The configuration. */
+                int mUdpFd = -1;                                            /*< The UDP socket. */
+                int mTcpFd = -1;                                            /*< The listening TCP socket. */
+                int mEventFd = -1;                                          /*< Wakes the I/O thread. */
+                std::atomic<bool> mStarted{false};                          /*< Start() succeeded. */
+                std::atomic<bool> mRunning{false};                          /*< Keeps the I/O thread running. */
+                std::thread mThread;                                        /*< The I/O thread. */
+                std::atomic<std::uint16_t> mSessionId{1U};                  /*< Next session id. */
+
+                std::mutex mHandlerMutex;                                   /*< Guards the handlers and subscribers. */
+                std::map<std::uint32_t, MethodEntry> mMethodHandlers;       /*< By service and method id. */
+                std::map<std::uint32_t, EventEntry> mEventHandlers;         /*< By service and event id. */
+                std::map<std::uint32_t, ara::core::Vector<Subscriber>> mSubscribers; /*< By service and event id. */
+
+                std::mutex mRequestMutex;                                   /*< Guards mRequests. */
+                std::map<std::uint16_t, PendingRequest> mRequests;          /*< By session id. */
+
+                std::mutex mSendMutex;                                      /*< Guards the datagram queues. */
+                ara::core::Vector<Datagram> mPending;                       /*< Partially filled, one per destination. */
+                ara::core::Vector<Datagram> mReady;                         /*< Full, waiting for the batch. */
+                bool mBatchOpen = false;                                    /*< A message waits to be sent. */
+                detail::Clock::time_point mBatchStart;                      /*< When the oldest waiting message was queued. */
+
+                std::mutex mTcpMutex;                                       /*< Guards mConnections and writes. */
+                ara::core::Vector<std::unique_ptr<Connection>> mConnections; /*< Accepted and outgoing connections. */
+
+                ara::core::Vector<ara::core::Byte> mReceiveBuffer;          /*< syscallBatchSize datagram slots. */
+                ara::core::Vector<iovec> mReceiveVectors;                   /*< One per slot. */
+                ara::core::Vector<mmsghdr> mReceiveHeaders;                 /*< One per slot. */
+                ara::core::Vector<sockaddr_storage> mReceiveAddresses;      /*< One per slot. */
+
+                std::atomic<std::uint64_t> mMessagesSent{0U};
+                std::atomic<std::uint64_t> mDatagramsSent{0U};
+                std::atomic<std::uint64_t> mSendCalls{0U};
+                std::atomic<std::uint64_t> mMessagesReceived{0U};
+                std::atomic<std::uint64_t> mDatagramsReceived{0U};
+                std::atomic<std::uint64_t> mReceiveCalls{0U};
+                std::atomic<std::uint64_t> mMalformedMessages{0U};
+            };
+
+            SomeIpBinding::SomeIpBinding(SomeIpBindingConfig const &config) : mImpl(new Impl(config))
+            {
+            }
+
+            SomeIpBinding::~SomeIpBinding() noexcept = default;
+
+            ara::core::Result<void> SomeIpBinding::Start() noexcept
+            {
+                try
+                {
+                    return mImpl->Start();
+                }
+                catch (std::bad_alloc const &)
+                {
+                    return ara::core::Result<void>::FromError(detail::BindingError(ENOMEM));
+                }
+            }
+
+            ara::core::Result<std::uint16_t> SomeIpBinding::GetLocalPort(TransportProtocol protocol) const noexcept
+            {
+                return mImpl->GetLocalPort(protocol);
+            }
+
+            void SomeIpBinding::SetMethodHandler(std::uint16_t serviceId, std::uint16_t methodId, MethodHandler handler, void *context)
+            {
+                mImpl->SetMethodHandler(serviceId, methodId, handler, context);
+            }
+
+            void SomeIpBinding::SetEventHandler(std::uint16_t serviceId, std::uint16_t eventId, EventHandler handler, void *context)
+            {
+                mImpl->SetEventHandler(serviceId, eventId, handler, context);
+            }
+
+            ara::core::Result<void> SomeIpBinding::AddSubscriber(std::uint16_t serviceId, std::uint16_t eventId, ara::core::String const &address, std::uint16_t port, TransportProtocol protocol) noexcept
+            {
+                try
+                {
+                    return mImpl->AddSubscriber(serviceId, eventId, address, port, protocol);
+                }
+                catch (std::bad_alloc const &)
+                {
+                    return ara::core::Result<void>::FromError(detail::BindingError(ENOMEM));
+                }
+            }
+
+            ara::core::Result<void> SomeIpBinding::SendNotification(std::uint16_t serviceId, std::uint16_t eventId, ara::core::Span<ara::core::Byte const> payload) noexcept
+            {
+                try
+                {
+                    return mImpl->SendNotification(serviceId, eventId, payload);
+                }
+                catch (std::bad_alloc const &)
+                {
+                    return ara::core::Result<void>::FromError(detail::BindingError(ENOMEM));
+                }
+            }
+
+            ara::core::Result<void> SomeIpBinding::SendRequest(std::uint16_t serviceId, std::uint16_t methodId, ara::core::String const &address, std::uint16_t port, TransportProtocol protocol, ara::core::Span<ara::core::Byte const> payload, ResponseHandler handler, void *context) noexcept
+            {
+                try
+                {
+                    return mImpl->SendRequest(serviceId, methodId, address, port, protocol, payload, handler, context);
+                }
+                catch (std::bad_alloc const &)
+                {
+                    return ara::core::Result<void>::FromError(detail::BindingError(ENOMEM));
+                }
+            }
+
+            ara::core::Result<void> SomeIpBinding::Flush() noexcept
+            {
+                try
+                {
+                    return mImpl->Flush();
+                }
+                catch (std::bad_alloc const &)
+                {
+                    return ara::core::Result<void>::FromError(detail::BindingError(ENOMEM));
+                }
+            }
+
+            SomeIpBindingStatistics SomeIpBinding::GetStatistics() const noexcept
+            {
+                return mImpl->GetStatistics();
+            }
+        } // namespace someip
+        
+    } // namespace com
+    
+} // namespace ara
@@ -0,0 +1,149 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ara/com/sample_queue.h"
+
+namespace test
+{
+    /**
+     * \brief A queue as laid out in the shared segment, in local memory.
+     * 
+     */
+    template <std::uint32_t Capacity>
+    struct Queue
+    {
+        ara::com::SampleQueueHeader header;
+        std::atomic<std::uint32_t> entries[Capacity];
+
+        Queue()
+        {
+            header.writeIndex.store(0U);
+            header.droppedSamples.store(0U);
+            header.readIndex.store(0U);
+            header.capacity = Capacity;
+            header.maxSampleCount = Capacity;
+            header.state.store(ara::com::SampleQueueState::kSubscribed);
+            header.entriesOffset = 0U;
+            for (auto &entry : entries)
+            {
+                entry.store(ara::com::kNoEventSlot);
+            }
+        }
+
+        ara::com::SampleQueueWriter Writer()
+        {
+            return ara::com::SampleQueueWriter(header, ara::core::Span<std::atomic<std::uint32_t>>(entries, Capacity));
+        }
+
+        ara::com::SampleQueueReader Reader()
+        {
+            return ara::com::SampleQueueReader(header, ara::core::Span<std::atomic<std::uint32_t> const>(entries, Capacity));
+        }
+    };
+}
+
+TEST(SampleQueueTest, PopsInOrder)
+{
+    test::Queue<4> queue;
+    auto writer = queue.Writer();
+    auto reader = queue.Reader();
+
+    EXPECT_TRUE(writer.Push(7U));
+    EXPECT_TRUE(writer.Push(8U));
+    EXPECT_EQ(2U, reader.GetAvailable());
+
+    std::vector<std::uint32_t> popped;
+    EXPECT_EQ(2U, reader.PopBatch([&popped](std::uint32_t slot) { popped.push_back(slot); }, 10U));
+    EXPECT_EQ((std::vector<std::uint32_t>{7U, 8U}), popped);
+    EXPECT_EQ(0U, reader.GetAvailable());
+    EXPECT_EQ(2U, queue.header.readIndex.load());
+}
+
+TEST(SampleQueueTest, PopBatchHonorsMaxCount)
+{
+    test::Queue<8> queue;
+    auto writer = queue.Writer();
+    auto reader = queue.Reader();
+    for (std::uint32_t i = 0U; i < 5U; ++i)
+    {
+        EXPECT_TRUE(writer.Push(i));
+    }
+
+    std::vector<std::uint32_t> popped;
+    EXPECT_EQ(3U, reader.PopBatch([&popped](std::uint32_t slot) { popped.push_back(slot); }, 3U));
+    EXPECT_EQ(2U, reader.PopBatch([&popped](std::uint32_t slot) { popped.push_back(slot); }, 3U));
+    EXPECT_EQ(0U, reader.PopBatch([&popped](std::uint32_t slot) { popped.push_back(slot); }, 3U));
+    EXPECT_EQ((std::vector<std::uint32_t>{0U, 1U, 2U, 3U, 4U}), popped);
+}
+
+TEST(SampleQueueTest, FullQueueDropsNewestSample)
+{
+    test::Queue<2> queue;
+    auto writer = queue.Writer();
+    auto reader = queue.Reader();
+
+    EXPECT_TRUE(writer.Push(1U));
+    EXPECT_TRUE(writer.Push(2U));
+    EXPECT_FALSE(writer.Push(3U));
+    EXPECT_EQ(1U, queue.header.droppedSamples.load());
+    EXPECT_EQ(0U, queue.header.readIndex.load());
+
+    std::vector<std::uint32_t> popped;
+    reader.PopBatch([&popped](std::uint32_t slot) { popped.push_back(slot); }, 1U);
+    EXPECT_TRUE(writer.Push(4U));
+    reader.PopBatch([&popped](std::uint32_t slot) { popped.push_back(slot); }, 10U);
+    EXPECT_EQ((std::vector<std::uint32_t>{1U, 2U, 4U}), popped);
+}
+
+TEST(SampleQueueTest, WriterResumesFromSharedIndices)
+{
+    test::Queue<4> queue;
+    {
+        auto writer = queue.Writer();
+        EXPECT_TRUE(writer.Push(1U));
+    }
+    auto writer = queue.Writer();
+    EXPECT_TRUE(writer.Push(2U));
+
+    std::vector<std::uint32_t> popped;
+    queue.Reader().PopBatch([&popped](std::uint32_t slot) { popped.push_back(slot); }, 10U);
+    EXPECT_EQ((std::vector<std::uint32_t>{1U, 2U}), popped);
+}
+
+TEST(SampleQueueTest, ConcurrentPublisherAndSubscriber)
+{
+    constexpr std::uint32_t kSamples = 200000U;
+    test::Queue<16> queue;
+    auto writer = queue.Writer();
+    auto reader = queue.Reader();
+
+    std::uint32_t pushed = 0U;
+    std::thread publisher([&writer, &pushed]() {
+        for (std::uint32_t i = 0U; i < kSamples; ++i)
+        {
+            if (writer.Push(i))
+            {
+                ++pushed;
+            }
+        }
+    });
+
+    std::uint32_t received = 0U;
+    std::uint32_t last = 0U;
+    bool ordered = true;
+    while ((received + queue.header.droppedSamples.load()) != kSamples)
+    {
+        reader.PopBatch([&](std::uint32_t slot) {
+            ordered = ordered && ((received == 0U) || (slot > last));
+            last = slot;
+            ++received;
+        }, 8U);
+    }
+    publisher.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(pushed, received);
+    EXPECT_EQ(kSamples, received + queue.header.droppedSamples.load());
+}
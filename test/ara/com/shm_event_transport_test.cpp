@@ -0,0 +1,208 @@
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "ara/com/shm_event_transport.h"
+
+namespace test
+{
+    constexpr std::uint32_t kSlotCount = 8U;
+    constexpr std::uint32_t kPayloadSize = 4096U;
+    constexpr std::uint32_t kQueueCapacity = 4U;
+    constexpr std::uint32_t kSamples = 20000U;
+
+    /**
+     * \brief A segment of one event with one subscriber, laid out as described by EventSegmentHeader and
+     *        mapped shared, so it is accessed from a forked subscriber process like from a proxy.
+     * 
+     */
+    class Segment
+    {
+    public:
+        Segment()
+        {
+            mSlotSize = static_cast<std::uint32_t>(sizeof(ara::com::EventSlotHeader)) + kPayloadSize;
+            std::size_t const slotsOffset = 64U * ((sizeof(ara::com::EventSegmentHeader) + 63U) / 64U);
+            std::size_t const queuesOffset = slotsOffset + kSlotCount * mSlotSize;
+            std::size_t const entriesOffset = queuesOffset + sizeof(ara::com::SampleQueueHeader);
+            mSize = entriesOffset + kQueueCapacity * sizeof(std::atomic<std::uint32_t>);
+
+            mBase = static_cast<std::uint8_t *>(mmap(nullptr, mSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+            if (mBase == MAP_FAILED)
+            {
+                mBase = nullptr;
+                return;
+            }
+
+            auto *header = new (mBase) ara::com::EventSegmentHeader;
+            header->magic = ara::com::kEventSegmentMagic;
+            header->layoutVersion = 1U;
+            header->slotCount = kSlotCount;
+            header->slotSize = mSlotSize;
+            header->maxSampleCount = kQueueCapacity;
+            header->maxSubscribers = 1U;
+            header->slotsOffset = slotsOffset;
+            header->queuesOffset = queuesOffset;
+            header->subscribersOffset = 0U;
+            header->freeHead.store(0U);
+            header->subscriberMask.store(1U);
+
+            for (std::uint32_t i = 0U; i < kSlotCount; ++i)
+            {
+                auto *slot = new (mBase + slotsOffset + i * mSlotSize) ara::com::EventSlotHeader;
+                slot->refCount.store(0U);
+                slot->nextFree = i + 1U;
+                slot->sequence = 0U;
+            }
+
+            auto *queue = new (mBase + queuesOffset) ara::com::SampleQueueHeader;
+            queue->writeIndex.store(0U);
+            queue->droppedSamples.store(0U);
+            queue->readIndex.store(0U);
+            queue->capacity = kQueueCapacity;
+            queue->maxSampleCount = kQueueCapacity;
+            queue->state.store(ara::com::SampleQueueState::kSubscribed);
+            queue->entriesOffset = static_cast<std::uint32_t>(entriesOffset);
+            for (std::uint32_t i = 0U; i < kQueueCapacity; ++i)
+            {
+                new (&Entries()[i]) std::atomic<std::uint32_t>(ara::com::kNoEventSlot);
+            }
+        }
+
+        ~Segment()
+        {
+            if (mBase != nullptr)
+            {
+                munmap(mBase, mSize);
+            }
+        }
+
+        bool IsMapped() const
+        {
+            return mBase != nullptr;
+        }
+
+        ara::com::EventSegmentHeader& Header()
+        {
+            return *reinterpret_cast<ara::com::EventSegmentHeader *>(mBase);
+        }
+
+        ara::com::EventSlotHeader& Slot(std::uint32_t index)
+        {
+            return *reinterpret_cast<ara::com::EventSlotHeader *>(mBase + Header().slotsOffset + index * mSlotSize);
+        }
+
+        std::uint8_t* Payload(std::uint32_t index)
+        {
+            return reinterpret_cast<std::uint8_t *>(&Slot(index)) + sizeof(ara::com::EventSlotHeader);
+        }
+
+        ara::com::SampleQueueHeader& Queue()
+        {
+            return *reinterpret_cast<ara::com::SampleQueueHeader *>(mBase + Header().queuesOffset);
+        }
+
+        std::atomic<std::uint32_t>* Entries()
+        {
+            return reinterpret_cast<std::atomic<std::uint32_t> *>(mBase + Queue().entriesOffset);
+        }
+
+    private:
+        std::uint8_t *mBase = nullptr;
+        std::size_t mSize = 0U;
+        std::uint32_t mSlotSize = 0U;
+    };
+
+    /**
+     * \brief The subscriber: checks every received frame in place and releases its slot.
+     * 
+     * \return int  the exit status, 0 if all frames were intact and in order
+     */
+    int Subscribe(Segment &segment)
+    {
+        ara::com::SampleQueueReader reader(segment.Queue(), ara::core::Span<std::atomic<std::uint32_t> const>(segment.Entries(), kQueueCapacity));
+        std::uint64_t received = 0U;
+        std::uint64_t last = 0U;
+        int status = 0;
+        while (received + segment.Queue().droppedSamples.load() < kSamples)
+        {
+            reader.PopBatch([&](std::uint32_t index) {
+                ara::com::EventSlotHeader &slot = segment.Slot(index);
+                std::uint8_t const expected = static_cast<std::uint8_t>(slot.sequence);
+                std::uint8_t const *payload = segment.Payload(index);
+                for (std::uint32_t i = 0U; i < kPayloadSize; ++i)
+                {
+                    if (payload[i] != expected)
+                    {
+                        status = 1;
+                    }
+                }
+                if ((received > 0U) && (slot.sequence <= last))
+                {
+                    status = 2;
+                }
+                last = slot.sequence;
+                ++received;
+                slot.refCount.fetch_sub(1U, std::memory_order_acq_rel);
+            }, kQueueCapacity);
+        }
+        return status;
+    }
+
+    /**
+     * \brief The publisher: fills a free slot in place and queues it, following ShmSkeletonEvent::Send().
+     * 
+     */
+    void Publish(Segment &segment)
+    {
+        ara::com::SampleQueueWriter writer(segment.Queue(), ara::core::Span<std::atomic<std::uint32_t>>(segment.Entries(), kQueueCapacity));
+        std::uint32_t index = 0U;
+        for (std::uint64_t sequence = 0U; sequence < kSamples; ++sequence)
+        {
+            // The free stack is not part of this test; a slot is free once its count dropped to 0.
+            while (segment.Slot(index).refCount.load(std::memory_order_acquire) != 0U)
+            {
+                index = (index + 1U) % kSlotCount;
+            }
+            ara::com::EventSlotHeader &slot = segment.Slot(index);
+            std::memset(segment.Payload(index), static_cast<std::uint8_t>(sequence), kPayloadSize);
+            slot.sequence = sequence;
+            slot.refCount.store(2U, std::memory_order_relaxed);
+            if (!writer.Push(index))
+            {
+                slot.refCount.fetch_sub(1U, std::memory_order_acq_rel);
+            }
+            slot.refCount.fetch_sub(1U, std::memory_order_acq_rel);
+        }
+    }
+}
+
+TEST(ShmEventTransportTest, SegmentIsSharedWithSubscriberProcess)
+{
+    test::Segment segment;
+    ASSERT_TRUE(segment.IsMapped());
+
+    pid_t const child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        _exit(test::Subscribe(segment));
+    }
+
+    test::Publish(segment);
+    int status = 0;
+    ASSERT_EQ(child, waitpid(child, &status, 0));
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(0, WEXITSTATUS(status));
+
+    // Every reference was released exactly once, by the publisher or by the subscriber.
+    for (std::uint32_t i = 0U; i < test::kSlotCount; ++i)
+    {
+        EXPECT_EQ(0U, segment.Slot(i).refCount.load());
+    }
+    EXPECT_EQ(test::kSamples, segment.Queue().readIndex.load() + segment.Queue().droppedSamples.load());
+}
@@ -0,0 +1,263 @@
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include "ara/com/someip/serializer.h"
+
+namespace test
+{
+    struct Point
+    {
+        std::uint16_t x;
+        std::uint32_t y;
+        bool visible;
+    };
+
+    struct Route
+    {
+        ara::core::String name;
+        ara::core::Vector<Point> points;
+        ara::core::Map<std::uint8_t, ara::core::String> labels;
+        ara::core::Variant<std::uint32_t, ara::core::String> tag;
+    };
+
+    struct Extensible
+    {
+        std::uint8_t version;
+        ara::core::String name;
+        ara::core::Array<std::uint16_t, 2> pair;
+        ara::core::Optional<std::uint32_t> counter;
+    };
+
+    struct Tlv : ara::com::someip::DefaultSerializationProps
+    {
+        static constexpr std::size_t structLengthFieldSize = 4U;
+    };
+
+    struct SmallLengths : Tlv
+    {
+        static constexpr std::size_t stringLengthFieldSize = 1U;
+        static constexpr std::size_t arrayLengthFieldSize = 2U;
+    };
+
+    struct LittleEndian : ara::com::someip::DefaultSerializationProps
+    {
+        static constexpr ara::com::someip::ByteOrder byteOrder = ara::com::someip::ByteOrder::kLittleEndian;
+    };
+
+    using Buffer = ara::core::Vector<ara::core::Byte>;
+
+    Buffer Bytes(std::initializer_list<std::uint8_t> values)
+    {
+        Buffer buffer;
+        for (std::uint8_t value : values)
+        {
+            buffer.push_back(static_cast<ara::core::Byte>(value));
+        }
+        return buffer;
+    }
+
+    template <typename T, typename Props = ara::com::someip::DefaultSerializationProps>
+    Buffer SerializeToBuffer(T const &value)
+    {
+        Buffer buffer(ara::com::someip::GetSerializedSize<T, Props>(value));
+        auto const written = ara::com::someip::Serialize<T, Props>(value, buffer);
+        EXPECT_TRUE(written.HasValue());
+        EXPECT_EQ(written.ValueOr(0U), buffer.size());
+        return buffer;
+    }
+
+    template <typename T, typename Props = ara::com::someip::DefaultSerializationProps>
+    T RoundTrip(T const &value)
+    {
+        Buffer const buffer = SerializeToBuffer<T, Props>(value);
+        T result{};
+        auto const read = ara::com::someip::Deserialize<T, Props>(ara::core::Span<ara::core::Byte const>(buffer), result);
+        EXPECT_TRUE(read.HasValue());
+        EXPECT_EQ(read.ValueOr(0U), buffer.size());
+        return result;
+    }
+}
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            template <>
+            struct StructTraits<test::Point>
+            {
+                using Fields = std::tuple<Field<test::Point, std::uint16_t, &test::Point::x>,
+                                          Field<test::Point, std::uint32_t, &test::Point::y>,
+                                          Field<test::Point, bool, &test::Point::visible>>;
+            };
+
+            template <>
+            struct StructTraits<test::Route>
+            {
+                using Fields = std::tuple<Field<test::Route, ara::core::String, &test::Route::name>,
+                                          Field<test::Route, ara::core::Vector<test::Point>, &test::Route::points>,
+                                          Field<test::Route, ara::core::Map<std::uint8_t, ara::core::String>, &test::Route::labels>,
+                                          Field<test::Route, ara::core::Variant<std::uint32_t, ara::core::String>, &test::Route::tag>>;
+            };
+
+            template <>
+            struct StructTraits<test::Extensible>
+            {
+                using Fields = std::tuple<Field<test::Extensible, std::uint8_t, &test::Extensible::version, 1U>,
+                                          Field<test::Extensible, ara::core::String, &test::Extensible::name, 2U>,
+                                          Field<test::Extensible, ara::core::Array<std::uint16_t, 2>, &test::Extensible::pair, 3U>,
+                                          Field<test::Extensible, ara::core::Optional<std::uint32_t>, &test::Extensible::counter, 4U>>;
+            };
+        }
+    }
+}
+
+namespace someip = ara::com::someip;
+
+static_assert(someip::IsFixedSize<test::Point>::value, "a struct of scalars is fixed-size");
+static_assert(someip::kFixedSerializedSize<test::Point> == 7U, "2 + 4 + 1 bytes");
+static_assert(noexcept(someip::Deserialize(std::declval<ara::core::Span<ara::core::Byte const>>(), std::declval<test::Point&>())),
+    "fixed-size types deserialize without allocating");
+static_assert(!noexcept(someip::Deserialize(std::declval<ara::core::Span<ara::core::Byte const>>(), std::declval<test::Route&>())),
+    "deserializing containers allocates");
+
+TEST(SerializerTest, ScalarsAreBigEndianByDefault)
+{
+    EXPECT_EQ(test::SerializeToBuffer(std::uint32_t{0x01020304U}), test::Bytes({1, 2, 3, 4}));
+    EXPECT_EQ((test::SerializeToBuffer<std::uint32_t, test::LittleEndian>(0x01020304U)), test::Bytes({4, 3, 2, 1}));
+    EXPECT_EQ(test::RoundTrip(-1.5), -1.5);
+    EXPECT_EQ(test::RoundTrip(true), true);
+}
+
+TEST(SerializerTest, FixedSizeStruct)
+{
+    test::Point const point{0x0102U, 0x03040506U, true};
+    EXPECT_EQ(test::SerializeToBuffer(point), test::Bytes({1, 2, 3, 4, 5, 6, 1}));
+    test::Point const result = test::RoundTrip(point);
+    EXPECT_EQ(result.x, point.x);
+    EXPECT_EQ(result.y, point.y);
+    EXPECT_EQ(result.visible, point.visible);
+}
+
+TEST(SerializerTest, StringHasLengthBomAndTerminator)
+{
+    EXPECT_EQ(test::SerializeToBuffer(ara::core::String("ab")), test::Bytes({0, 0, 0, 6, 0xEF, 0xBB, 0xBF, 'a', 'b', 0}));
+    EXPECT_EQ(test::RoundTrip(ara::core::String("")), "");
+    EXPECT_EQ(test::RoundTrip(ara::core::String("some/ip")), "some/ip");
+}
+
+TEST(SerializerTest, ContainersAndVariants)
+{
+    test::Route route;
+    route.name = "ring";
+    route.points = {{1U, 2U, false}, {3U, 4U, true}};
+    route.labels = {{1U, "start"}, {2U, "end"}};
+    route.tag = ara::core::String("tag");
+
+    test::Route const result = test::RoundTrip(route);
+    EXPECT_EQ(result.name, route.name);
+    ASSERT_EQ(result.points.size(), 2U);
+    EXPECT_EQ(result.points[1].y, 4U);
+    EXPECT_TRUE(result.points[1].visible);
+    EXPECT_EQ(result.labels, route.labels);
+    ASSERT_TRUE(ara::core::holds_alternative<ara::core::String>(result.tag));
+    EXPECT_EQ(ara::core::get<ara::core::String>(result.tag), "tag");
+
+    route.tag = std::uint32_t{7U};
+    EXPECT_EQ(ara::core::get<std::uint32_t>(test::RoundTrip(route).tag), 7U);
+}
+
+TEST(SerializerTest, TruncatedAndMalformedDataIsRejected)
+{
+    test::Buffer const buffer = test::SerializeToBuffer(ara::core::Vector<std::uint16_t>{1U, 2U, 3U});
+    ara::core::Vector<std::uint16_t> value;
+    for (std::size_t size = 0U; size < buffer.size(); ++size)
+    {
+        auto const result = someip::Deserialize(ara::core::Span<ara::core::Byte const>(buffer.data(), size), value);
+        ASSERT_FALSE(result.HasValue());
+        EXPECT_EQ(result.Error(), ara::com::MakeErrorCode(ara::com::ComErrc::kNetworkBindingFailure, 0));
+    }
+
+    // A length that is not a multiple of the element size.
+    test::Buffer const odd = test::Bytes({0, 0, 0, 3, 0, 1, 0});
+    EXPECT_FALSE(someip::Deserialize(ara::core::Span<ara::core::Byte const>(odd), value).HasValue());
+
+    ara::core::String text;
+    test::Buffer const noBom = test::Bytes({0, 0, 0, 4, 'a', 'b', 'c', 0});
+    EXPECT_FALSE(someip::Deserialize(ara::core::Span<ara::core::Byte const>(noBom), text).HasValue());
+}
+
+TEST(SerializerTest, BufferTooSmall)
+{
+    test::Buffer buffer(3U);
+    auto const result = someip::Serialize(std::uint32_t{1U}, ara::core::Span<ara::core::Byte>(buffer));
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), ara::com::MakeErrorCode(ara::com::ComErrc::kNetworkBindingFailure, 0));
+}
+
+TEST(SerializerTest, TlvReusesTheMemberLengthField)
+{
+    test::Extensible value;
+    value.version = 9U;
+    value.name = "n";
+    value.pair = {{0x0102U, 0x0304U}};
+
+    // version: wire type 0; name: wire type 7 with the string's own length field; pair: wire type 7 with
+    // an additional length field, since fixed-length arrays have none; counter: absent.
+    test::Buffer const expected = test::Bytes({
+        0, 0, 0, 24,
+        0x00, 0x01, 9,
+        0x70, 0x02, 0, 0, 0, 5, 0xEF, 0xBB, 0xBF, 'n', 0,
+        0x70, 0x03, 0, 0, 0, 4, 1, 2, 3, 4});
+    EXPECT_EQ((test::SerializeToBuffer<test::Extensible, test::Tlv>(value)), expected);
+
+    value.counter = 0x0A0B0C0DU;
+    test::Extensible const result = test::RoundTrip<test::Extensible, test::Tlv>(value);
+    EXPECT_EQ(result.version, 9U);
+    EXPECT_EQ(result.name, "n");
+    EXPECT_EQ(result.pair, value.pair);
+    EXPECT_EQ(result.counter, value.counter);
+}
+
+TEST(SerializerTest, TlvWireTypeFollowsTheLengthFieldSize)
+{
+    test::Extensible value;
+    value.version = 1U;
+    value.name = "n";
+    value.pair = {{1U, 2U}};
+
+    // With a one byte string length field, the name uses wire type 5.
+    test::Buffer const buffer = test::SerializeToBuffer<test::Extensible, test::SmallLengths>(value);
+    test::Buffer const name = test::Bytes({0x50, 0x02, 5, 0xEF, 0xBB, 0xBF, 'n', 0});
+    EXPECT_NE(std::search(buffer.begin(), buffer.end(), name.begin(), name.end()), buffer.end());
+    EXPECT_EQ((test::RoundTrip<test::Extensible, test::SmallLengths>(value).name), "n");
+}
+
+TEST(SerializerTest, TlvSkipsUnknownMembersAndRequiresMandatoryOnes)
+{
+    // version, an unknown member with data id 9 and wire type 6, then name; counter is absent.
+    test::Buffer const buffer = test::Bytes({
+        0, 0, 0, 30,
+        0x00, 0x01, 3,
+        0x60, 0x09, 0, 2, 0xAA, 0xBB,
+        0x70, 0x02, 0, 0, 0, 5, 0xEF, 0xBB, 0xBF, 'x', 0,
+        0x70, 0x03, 0, 0, 0, 4, 0, 5, 0, 6});
+    test::Extensible value;
+    value.counter = 1U;
+    auto const read = someip::Deserialize<test::Extensible, test::Tlv>(ara::core::Span<ara::core::Byte const>(buffer), value);
+    ASSERT_TRUE(read.HasValue());
+    EXPECT_EQ(read.Value(), buffer.size());
+    EXPECT_EQ(value.version, 3U);
+    EXPECT_EQ(value.name, "x");
+    EXPECT_EQ(value.pair[1], 6U);
+    EXPECT_FALSE(value.counter.has_value());
+
+    // Without the mandatory member name.
+    test::Buffer const missing = test::Bytes({0, 0, 0, 3, 0x00, 0x01, 3});
+    EXPECT_FALSE((someip::Deserialize<test::Extensible, test::Tlv>(ara::core::Span<ara::core::Byte const>(missing), value).HasValue()));
+
+    // name with a wire type other than the one it is written with.
+    test::Buffer const wrongType = test::Bytes({0, 0, 0, 8, 0x00, 0x01, 3, 0x50, 0x02, 1, 0});
+    EXPECT_FALSE((someip::Deserialize<test::Extensible, test::Tlv>(ara::core::Span<ara::core::Byte const>(wrongType), value).HasValue()));
+}
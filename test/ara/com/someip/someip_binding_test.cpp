@@ -0,0 +1,324 @@
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "ara/com/someip/someip_binding.h"
+
+namespace test
+{
+    using ara::com::someip::MessageHeader;
+    using ara::com::someip::SomeIpBinding;
+    using ara::com::someip::SomeIpBindingConfig;
+    using ara::com::someip::TransportProtocol;
+    using Buffer = ara::core::Vector<ara::core::Byte>;
+
+    constexpr std::uint16_t kServiceId = 0x1234U;
+    constexpr std::uint16_t kMethodId = 0x0001U;
+    constexpr std::uint16_t kEventId = 0x0010U;
+
+    Buffer Bytes(std::size_t size, std::uint8_t value)
+    {
+        return Buffer(size, static_cast<ara::core::Byte>(value));
+    }
+
+    Buffer Bytes(std::initializer_list<std::uint8_t> values)
+    {
+        Buffer buffer;
+        for (std::uint8_t value : values)
+        {
+            buffer.push_back(static_cast<ara::core::Byte>(value));
+        }
+        return buffer;
+    }
+
+    /**
+     * \brief Collects what the handlers receive on the I/O thread.
+     * 
+     */
+    struct Inbox
+    {
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::size_t notifications = 0U;
+        std::size_t responses = 0U;
+        std::size_t errors = 0U;
+        ara::core::ErrorCode lastError{ara::com::ComErrc::kNetworkBindingFailure};
+        Buffer lastPayload;
+
+        template <typename Predicate>
+        bool WaitFor(Predicate predicate)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            return changed.wait_for(lock, std::chrono::seconds(5), [this, &predicate]() { return predicate(*this); });
+        }
+    };
+
+    ara::core::Result<Buffer> Echo(MessageHeader const &, ara::core::Span<ara::core::Byte const> payload, void *)
+    {
+        return ara::core::Result<Buffer>::FromValue(Buffer(payload.begin(), payload.end()));
+    }
+
+    void OnNotification(MessageHeader const &, ara::core::Span<ara::core::Byte const> payload, void *context)
+    {
+        Inbox &inbox = *static_cast<Inbox *>(context);
+        std::lock_guard<std::mutex> lock(inbox.mutex);
+        ++inbox.notifications;
+        inbox.lastPayload.assign(payload.begin(), payload.end());
+        inbox.changed.notify_all();
+    }
+
+    void OnResponse(ara::core::Result<Buffer> response, void *context)
+    {
+        Inbox &inbox = *static_cast<Inbox *>(context);
+        std::lock_guard<std::mutex> lock(inbox.mutex);
+        if (response)
+        {
+            ++inbox.responses;
+            inbox.lastPayload = response.Value();
+        }
+        else
+        {
+            ++inbox.errors;
+            inbox.lastError = response.Error();
+        }
+        inbox.changed.notify_all();
+    }
+
+    std::uint16_t Port(SomeIpBinding const &binding, TransportProtocol protocol)
+    {
+        auto port = binding.GetLocalPort(protocol);
+        EXPECT_TRUE(port.HasValue());
+        return port.ValueOr(0U);
+    }
+
+    /**
+     * \brief Waits until a condition which is not signalled by a handler holds.
+     * 
+     */
+    template <typename Predicate>
+    bool Eventually(Predicate predicate)
+    {
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    /**
+     * \brief Opens a UDP socket bound to an ephemeral loopback port.
+     * 
+     */
+    int BindRawSocket()
+    {
+        int const fd = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if ((fd >= 0) && (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0))
+        {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    std::uint16_t LocalPort(int fd)
+    {
+        sockaddr_in address;
+        socklen_t length = sizeof(address);
+        EXPECT_EQ(0, getsockname(fd, reinterpret_cast<sockaddr *>(&address), &length));
+        return ntohs(address.sin_port);
+    }
+
+    /**
+     * \brief Sends raw bytes to a UDP port on loopback.
+     * 
+     */
+    void SendRawDatagram(std::uint16_t port, Buffer const &data)
+    {
+        int const fd = socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(fd, 0);
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        EXPECT_EQ(static_cast<ssize_t>(data.size()), sendto(fd, data.data(), data.size(), 0, reinterpret_cast<sockaddr *>(&address), sizeof(address)));
+        close(fd);
+    }
+}
+
+TEST(SomeIpBindingTest, UdpRequestResponse)
+{
+    test::SomeIpBindingConfig config;
+    config.tcpEnabled = false;
+    test::SomeIpBinding server(config);
+    test::SomeIpBinding client(config);
+    ASSERT_TRUE(server.Start().HasValue());
+    ASSERT_TRUE(client.Start().HasValue());
+    server.SetMethodHandler(test::kServiceId, test::kMethodId, &test::Echo, nullptr);
+
+    test::Inbox inbox;
+    test::Buffer const request = test::Bytes(32U, 0xA5U);
+    ASSERT_TRUE(client.SendRequest(test::kServiceId, test::kMethodId, "127.0.0.1", test::Port(server, test::TransportProtocol::kUdp), test::TransportProtocol::kUdp, request, &test::OnResponse, &inbox).HasValue());
+
+    ASSERT_TRUE(inbox.WaitFor([](test::Inbox const &i) { return i.responses + i.errors > 0U; }));
+    EXPECT_EQ(1U, inbox.responses);
+    EXPECT_EQ(request, inbox.lastPayload);
+    EXPECT_EQ(1U, server.GetStatistics().messagesReceived);
+}
+
+TEST(SomeIpBindingTest, TcpRequestResponse)
+{
+    test::SomeIpBindingConfig config;
+    config.udpEnabled = false;
+    test::SomeIpBinding server(config);
+    test::SomeIpBinding client(config);
+    ASSERT_TRUE(server.Start().HasValue());
+    ASSERT_TRUE(client.Start().HasValue());
+    server.SetMethodHandler(test::kServiceId, test::kMethodId, &test::Echo, nullptr);
+
+    // Larger than a datagram, which is what TCP is used for.
+    test::Inbox inbox;
+    test::Buffer const request = test::Bytes(100000U, 0x5AU);
+    std::uint16_t const port = test::Port(server, test::TransportProtocol::kTcp);
+    ASSERT_TRUE(client.SendRequest(test::kServiceId, test::kMethodId, "127.0.0.1", port, test::TransportProtocol::kTcp, request, &test::OnResponse, &inbox).HasValue());
+    ASSERT_TRUE(client.SendRequest(test::kServiceId, test::kMethodId, "127.0.0.1", port, test::TransportProtocol::kTcp, test::Bytes(8U, 0x01U), &test::OnResponse, &inbox).HasValue());
+
+    ASSERT_TRUE(inbox.WaitFor([](test::Inbox const &i) { return i.responses + i.errors >= 2U; }));
+    EXPECT_EQ(2U, inbox.responses);
+    EXPECT_EQ(test::Bytes(8U, 0x01U), inbox.lastPayload);
+}
+
+TEST(SomeIpBindingTest, UdpNotificationsAreBatched)
+{
+    test::SomeIpBindingConfig config;
+    config.tcpEnabled = false;
+    test::SomeIpBinding server(config);
+    ASSERT_TRUE(server.Start().HasValue());
+    test::Inbox inbox;
+    server.SetEventHandler(test::kServiceId, test::kEventId, &test::OnNotification, &inbox);
+
+    config.maxBatchDelay = std::chrono::seconds(10);
+    test::SomeIpBinding client(config);
+    ASSERT_TRUE(client.Start().HasValue());
+    ASSERT_TRUE(client.AddSubscriber(test::kServiceId, test::kEventId, "127.0.0.1", test::Port(server, test::TransportProtocol::kUdp), test::TransportProtocol::kUdp).HasValue());
+
+    test::Buffer const payload = test::Bytes(100U, 0x42U);
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(client.SendNotification(test::kServiceId, test::kEventId, payload).HasValue());
+    }
+    EXPECT_EQ(0U, client.GetStatistics().sendCalls);
+    ASSERT_TRUE(client.Flush().HasValue());
+
+    // 12 messages of 116 bytes fit into a datagram of 1400 bytes.
+    auto const sent = client.GetStatistics();
+    EXPECT_EQ(100U, sent.messagesSent);
+    EXPECT_EQ(9U, sent.datagramsSent);
+    EXPECT_EQ(1U, sent.sendCalls);
+
+    ASSERT_TRUE(inbox.WaitFor([](test::Inbox const &i) { return i.notifications == 100U; }));
+    EXPECT_EQ(payload, inbox.lastPayload);
+    auto const received = server.GetStatistics();
+    EXPECT_EQ(9U, received.datagramsReceived);
+    EXPECT_EQ(0U, received.malformedMessages);
+}
+
+TEST(SomeIpBindingTest, BatchIsSentAfterMaxBatchDelay)
+{
+    test::SomeIpBindingConfig config;
+    config.tcpEnabled = false;
+    test::SomeIpBinding server(config);
+    test::SomeIpBinding client(config);
+    ASSERT_TRUE(server.Start().HasValue());
+    ASSERT_TRUE(client.Start().HasValue());
+    test::Inbox inbox;
+    server.SetEventHandler(test::kServiceId, test::kEventId, &test::OnNotification, &inbox);
+    ASSERT_TRUE(client.AddSubscriber(test::kServiceId, test::kEventId, "127.0.0.1", test::Port(server, test::TransportProtocol::kUdp), test::TransportProtocol::kUdp).HasValue());
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(client.SendNotification(test::kServiceId, test::kEventId, test::Bytes(16U, 0x07U)).HasValue());
+    }
+
+    ASSERT_TRUE(inbox.WaitFor([](test::Inbox const &i) { return i.notifications == 3U; }));
+    // The counters are updated after sendmmsg() returns, possibly after the datagram arrived.
+    ASSERT_TRUE(test::Eventually([&client]() { return client.GetStatistics().sendCalls == 1U; }));
+    EXPECT_EQ(1U, client.GetStatistics().datagramsSent);
+}
+
+TEST(SomeIpBindingTest, UnknownMethodIsAnsweredWithError)
+{
+    test::SomeIpBindingConfig config;
+    config.tcpEnabled = false;
+    config.maxBatchDelay = std::chrono::microseconds(0);
+    test::SomeIpBinding server(config);
+    test::SomeIpBinding client(config);
+    ASSERT_TRUE(server.Start().HasValue());
+    ASSERT_TRUE(client.Start().HasValue());
+
+    test::Inbox inbox;
+    ASSERT_TRUE(client.SendRequest(test::kServiceId, test::kMethodId, "127.0.0.1", test::Port(server, test::TransportProtocol::kUdp), test::TransportProtocol::kUdp, test::Bytes(4U, 0U), &test::OnResponse, &inbox).HasValue());
+
+    ASSERT_TRUE(inbox.WaitFor([](test::Inbox const &i) { return i.responses + i.errors > 0U; }));
+    EXPECT_EQ(1U, inbox.errors);
+    EXPECT_EQ(ara::com::ComErrc::kNetworkBindingFailure, static_cast<ara::com::ComErrc>(inbox.lastError.Value()));
+    EXPECT_EQ(static_cast<std::int32_t>(ara::com::someip::ReturnCode::kUnknownMethod), inbox.lastError.SupportData());
+}
+
+TEST(SomeIpBindingTest, RequestTimesOut)
+{
+    test::SomeIpBindingConfig config;
+    config.tcpEnabled = false;
+    config.requestTimeout = std::chrono::milliseconds(50);
+    test::SomeIpBinding client(config);
+    ASSERT_TRUE(client.Start().HasValue());
+
+    // A bound socket which never answers.
+    int const silent = test::BindRawSocket();
+    ASSERT_GE(silent, 0);
+
+    test::Inbox inbox;
+    ASSERT_TRUE(client.SendRequest(test::kServiceId, test::kMethodId, "127.0.0.1", test::LocalPort(silent), test::TransportProtocol::kUdp, test::Bytes(4U, 0U), &test::OnResponse, &inbox).HasValue());
+
+    ASSERT_TRUE(inbox.WaitFor([](test::Inbox const &i) { return i.responses + i.errors > 0U; }));
+    EXPECT_EQ(1U, inbox.errors);
+    EXPECT_EQ(ETIMEDOUT, inbox.lastError.SupportData());
+    close(silent);
+}
+
+TEST(SomeIpBindingTest, MalformedTailKeepsPrecedingMessage)
+{
+    test::SomeIpBindingConfig config;
+    config.tcpEnabled = false;
+    test::SomeIpBinding server(config);
+    ASSERT_TRUE(server.Start().HasValue());
+    test::Inbox inbox;
+    server.SetEventHandler(test::kServiceId, test::kEventId, &test::OnNotification, &inbox);
+
+    // A notification with a 4 byte payload, followed by 5 bytes which are too short for a header.
+    test::Buffer const datagram = test::Bytes({
+        0x12, 0x34, 0x80, 0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00,
+        0xDE, 0xAD, 0xBE, 0xEF,
+        0x01, 0x02, 0x03, 0x04, 0x05});
+    test::SendRawDatagram(test::Port(server, test::TransportProtocol::kUdp), datagram);
+
+    ASSERT_TRUE(inbox.WaitFor([](test::Inbox const &i) { return i.notifications == 1U; }));
+    EXPECT_EQ(test::Buffer(datagram.begin() + 16, datagram.begin() + 20), inbox.lastPayload);
+    ASSERT_TRUE(test::Eventually([&server]() { return server.GetStatistics().malformedMessages == 1U; }));
+}
@@ -0,0 +1,105 @@
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+#include "ara/core/optional.h"
+#include "ara/core/string.h"
+
+namespace
+{
+    struct Counted
+    {
+        static int alive;
+
+        explicit Counted(int v) : value{v}
+        {
+            ++alive;
+        }
+
+        Counted(Counted const &other) : value{other.value}
+        {
+            ++alive;
+        }
+
+        ~Counted()
+        {
+            --alive;
+        }
+
+        int value;
+    };
+
+    int Counted::alive = 0;
+}
+
+TEST(OptionalTest, DefaultIsEmpty)
+{
+    ara::core::Optional<int> value;
+    EXPECT_FALSE(value.has_value());
+    EXPECT_FALSE(static_cast<bool>(value));
+    EXPECT_TRUE(value == ara::core::nullopt);
+    EXPECT_EQ(value.value_or(7), 7);
+}
+
+TEST(OptionalTest, HoldsAndReplacesValue)
+{
+    ara::core::Optional<ara::core::String> value{"abc"};
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(*value, "abc");
+    EXPECT_EQ(value->size(), 3U);
+
+    value = ara::core::String("de");
+    EXPECT_EQ(value.value(), "de");
+
+    value.emplace(3U, 'x');
+    EXPECT_EQ(*value, "xxx");
+
+    value = ara::core::nullopt;
+    EXPECT_FALSE(value.has_value());
+}
+
+TEST(OptionalTest, CopyMoveAndSwap)
+{
+    ara::core::Optional<ara::core::String> a{"one"};
+    ara::core::Optional<ara::core::String> b{a};
+    EXPECT_EQ(a, b);
+
+    ara::core::Optional<ara::core::String> c{std::move(b)};
+    EXPECT_EQ(*c, "one");
+
+    ara::core::Optional<ara::core::String> d;
+    d.swap(c);
+    EXPECT_FALSE(c.has_value());
+    EXPECT_EQ(*d, "one");
+    EXPECT_TRUE(c < d);
+    EXPECT_NE(c, d);
+}
+
+TEST(OptionalTest, DestroysValueExactlyOnce)
+{
+    {
+        ara::core::Optional<Counted> value{ara::core::in_place, 5};
+        EXPECT_EQ(Counted::alive, 1);
+        ara::core::Optional<Counted> copy{value};
+        EXPECT_EQ(Counted::alive, 2);
+        copy.reset();
+        EXPECT_EQ(Counted::alive, 1);
+        value.emplace(6);
+        EXPECT_EQ(Counted::alive, 1);
+        EXPECT_EQ(value->value, 6);
+    }
+    EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(OptionalTest, MoveOnlyValue)
+{
+    ara::core::Optional<std::unique_ptr<int>> value{std::unique_ptr<int>(new int(4))};
+    ara::core::Optional<std::unique_ptr<int>> moved{std::move(value)};
+    ASSERT_TRUE(moved.has_value());
+    EXPECT_EQ(**moved, 4);
+}
+
+TEST(OptionalTest, AccessingEmptyOptionalTerminates)
+{
+    ara::core::Optional<int> value;
+    EXPECT_DEATH(static_cast<void>(*value), "");
+}
@@ -0,0 +1,224 @@
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+#include "ara/core/error_code.h"
+#include "ara/core/exception.h"
+#include "ara/core/result.h"
+#include "ara/core/string.h"
+
+namespace test
+{
+    enum class TestErrc : ara::core::ErrorDomain::CodeType
+    {
+        kFirst = 1,
+        kSecond = 2,
+    };
+
+    class TestException : public ara::core::Exception
+    {
+    public:
+        explicit TestException(ara::core::ErrorCode err) noexcept : ara::core::Exception(err)
+        {
+        }
+    };
+
+    class TestErrorDomain final : public ara::core::ErrorDomain
+    {
+    public:
+        constexpr TestErrorDomain() noexcept : ara::core::ErrorDomain(0x1234U)
+        {
+        }
+
+        char const* Name() const noexcept override
+        {
+            return "Test";
+        }
+
+        char const* Message(ara::core::ErrorDomain::CodeType errorCode) const noexcept override
+        {
+            return (errorCode == 1) ? "first" : "second";
+        }
+
+        void ThrowAsException(ara::core::ErrorCode const &errorCode) const noexcept(false) override
+        {
+            throw TestException(errorCode);
+        }
+    };
+
+    ara::core::ErrorDomain const& GetTestErrorDomain() noexcept
+    {
+        static TestErrorDomain const domain;
+        return domain;
+    }
+
+    ara::core::ErrorCode MakeErrorCode(TestErrc code, ara::core::ErrorDomain::SupportDataType data) noexcept
+    {
+        return ara::core::ErrorCode(static_cast<ara::core::ErrorDomain::CodeType>(code), GetTestErrorDomain(), data);
+    }
+
+    struct Counted
+    {
+        static int alive;
+
+        explicit Counted(int v) : value{v}
+        {
+            ++alive;
+        }
+
+        Counted(Counted const &other) : value{other.value}
+        {
+            ++alive;
+        }
+
+        Counted& operator=(Counted const &) = default;
+
+        ~Counted()
+        {
+            --alive;
+        }
+
+        int value;
+    };
+
+    int Counted::alive = 0;
+}
+
+TEST(ErrorCodeTest, FromEnumUsesMakeErrorCode)
+{
+    ara::core::ErrorCode const code(test::TestErrc::kSecond, 42);
+    EXPECT_EQ(code.Value(), 2);
+    EXPECT_EQ(code.SupportData(), 42);
+    EXPECT_EQ(code.Domain(), test::GetTestErrorDomain());
+    EXPECT_EQ(code.Domain().Id(), 0x1234U);
+    EXPECT_TRUE(code.Message() == "second");
+    EXPECT_EQ(code, ara::core::ErrorCode(test::TestErrc::kSecond, 7));
+    EXPECT_NE(code, ara::core::ErrorCode(test::TestErrc::kFirst));
+}
+
+TEST(ErrorCodeTest, ThrowAsExceptionThrowsTheDomainException)
+{
+    ara::core::ErrorCode const code(test::TestErrc::kFirst);
+    try
+    {
+        code.ThrowAsException();
+        FAIL();
+    }
+    catch (test::TestException const &e)
+    {
+        EXPECT_EQ(e.Error(), code);
+        EXPECT_STREQ(e.what(), "first");
+    }
+}
+
+TEST(ResultTest, HoldsValue)
+{
+    ara::core::Result<int> result(5);
+    EXPECT_TRUE(result.HasValue());
+    EXPECT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ(*result, 5);
+    EXPECT_EQ(result.Value(), 5);
+    EXPECT_EQ(result.ValueOr(9), 5);
+    EXPECT_EQ(result.ValueOrThrow(), 5);
+    EXPECT_FALSE(result.CheckError(test::TestErrc::kFirst));
+    EXPECT_EQ(result.ErrorOr(test::TestErrc::kFirst), ara::core::ErrorCode(test::TestErrc::kFirst));
+    EXPECT_TRUE(result == 5);
+    EXPECT_TRUE(5 == result);
+}
+
+TEST(ResultTest, HoldsError)
+{
+    auto result = ara::core::Result<int>::FromError(test::TestErrc::kSecond);
+    EXPECT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), ara::core::ErrorCode(test::TestErrc::kSecond));
+    EXPECT_EQ(result.ValueOr(9), 9);
+    EXPECT_TRUE(result.CheckError(test::TestErrc::kSecond));
+    EXPECT_EQ(result.Resolve([](ara::core::ErrorCode const &e) { return e.Value() * 10; }), 20);
+    EXPECT_TRUE(result == ara::core::ErrorCode(test::TestErrc::kSecond));
+    EXPECT_TRUE(result != 9);
+    EXPECT_THROW(result.ValueOrThrow(), test::TestException);
+}
+
+TEST(ResultTest, FromValueConstructsInPlace)
+{
+    auto result = ara::core::Result<ara::core::String>::FromValue(3U, 'x');
+    ASSERT_TRUE(result.HasValue());
+    EXPECT_EQ(result.Value(), "xxx");
+    EXPECT_EQ(result->size(), 3U);
+    ara::core::String moved = std::move(result).Value();
+    EXPECT_EQ(moved, "xxx");
+}
+
+TEST(ResultTest, CopyMoveAndAssignmentKeepObjectsBalanced)
+{
+    {
+        ara::core::Result<test::Counted> value(test::Counted{1});
+        ara::core::Result<test::Counted> error(ara::core::ErrorCode(test::TestErrc::kFirst));
+        EXPECT_EQ(test::Counted::alive, 1);
+
+        ara::core::Result<test::Counted> copy(value);
+        EXPECT_EQ(test::Counted::alive, 2);
+        copy = error;
+        EXPECT_EQ(test::Counted::alive, 1);
+        EXPECT_FALSE(copy.HasValue());
+        copy = std::move(value);
+        EXPECT_EQ(test::Counted::alive, 2);
+        EXPECT_EQ(copy->value, 1);
+
+        copy.Swap(error);
+        EXPECT_FALSE(copy.HasValue());
+        EXPECT_EQ(error->value, 1);
+        EXPECT_EQ(test::Counted::alive, 2);
+
+        copy.EmplaceValue(4);
+        EXPECT_EQ(copy->value, 4);
+        EXPECT_EQ(test::Counted::alive, 3);
+        copy.EmplaceError(test::TestErrc::kSecond);
+        EXPECT_EQ(test::Counted::alive, 2);
+    }
+    EXPECT_EQ(test::Counted::alive, 0);
+}
+
+TEST(ResultTest, BindTransformsTheValueAndForwardsTheError)
+{
+    ara::core::Result<int> value(4);
+    auto doubled = value.Bind([](int v) { return v * 2; });
+    EXPECT_EQ(doubled.Value(), 8);
+
+    auto chained = value.Bind([](int v) { return ara::core::Result<ara::core::String>(ara::core::String(static_cast<std::size_t>(v), 'a')); });
+    EXPECT_EQ(chained.Value(), "aaaa");
+
+    ara::core::Result<int> error(ara::core::ErrorCode(test::TestErrc::kFirst));
+    auto forwarded = error.Bind([](int v) { return v * 2; });
+    EXPECT_FALSE(forwarded.HasValue());
+    EXPECT_EQ(forwarded.Error(), ara::core::ErrorCode(test::TestErrc::kFirst));
+
+    ara::core::Result<void> done = value.Bind([](int) {});
+    EXPECT_TRUE(done.HasValue());
+}
+
+TEST(ResultTest, VoidResult)
+{
+    ara::core::Result<void> ok;
+    EXPECT_TRUE(ok.HasValue());
+    EXPECT_NO_THROW(ok.ValueOrThrow());
+
+    auto error = ara::core::Result<void>::FromError(test::TestErrc::kSecond);
+    EXPECT_FALSE(error.HasValue());
+    EXPECT_TRUE(error.CheckError(test::TestErrc::kSecond));
+    EXPECT_THROW(error.ValueOrThrow(), test::TestException);
+    EXPECT_FALSE(ok == error);
+
+    int calls = 0;
+    error.Resolve([&calls](ara::core::ErrorCode const &) { ++calls; });
+    ok.Resolve([&calls](ara::core::ErrorCode const &) { ++calls; });
+    EXPECT_EQ(calls, 1);
+
+    ok = error;
+    EXPECT_FALSE(ok.HasValue());
+    error.EmplaceValue();
+    EXPECT_TRUE(error.HasValue());
+    ok.Swap(error);
+    EXPECT_TRUE(ok.HasValue());
+    EXPECT_FALSE(error.HasValue());
+    EXPECT_TRUE(ok == ara::core::Result<void>::FromValue());
+}
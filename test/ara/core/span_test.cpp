@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <numeric>
+#include <gtest/gtest.h>
+#include "ara/core/array.h"
+#include "ara/core/span.h"
+#include "ara/core/vector.h"
+
+TEST(SpanTest, DefaultIsEmpty)
+{
+    ara::core::Span<int> span;
+    EXPECT_TRUE(span.empty());
+    EXPECT_EQ(span.size(), 0U);
+    EXPECT_EQ(span.data(), nullptr);
+    EXPECT_EQ(span.begin(), span.end());
+}
+
+TEST(SpanTest, ViewsContainersArraysAndRawArrays)
+{
+    ara::core::Vector<int> vector{1, 2, 3, 4};
+    ara::core::Span<int> fromVector(vector);
+    EXPECT_EQ(fromVector.size(), 4U);
+    EXPECT_EQ(fromVector.data(), vector.data());
+    fromVector[1] = 20;
+    EXPECT_EQ(vector[1], 20);
+
+    ara::core::Vector<int> const &constVector = vector;
+    ara::core::Span<int const> fromConstVector(constVector);
+    EXPECT_EQ(std::accumulate(fromConstVector.begin(), fromConstVector.end(), 0), 28);
+
+    ara::core::Array<std::uint8_t, 3> array{{7, 8, 9}};
+    ara::core::Span<std::uint8_t, 3> fromArray(array);
+    EXPECT_EQ(fromArray.size_bytes(), 3U);
+    EXPECT_EQ(decltype(fromArray)::extent, 3U);
+
+    int raw[] = {5, 6};
+    auto fromRaw = ara::core::MakeSpan(raw);
+    EXPECT_EQ(fromRaw.size(), 2U);
+    EXPECT_EQ(*fromRaw.rbegin(), 6);
+
+    ara::core::Span<int const> converted = fromVector;
+    EXPECT_EQ(converted.size(), 4U);
+}
+
+TEST(SpanTest, Subspans)
+{
+    int raw[] = {0, 1, 2, 3, 4, 5};
+    ara::core::Span<int> span(raw);
+    EXPECT_EQ(span.first(2).size(), 2U);
+    EXPECT_EQ(span.last(2)[0], 4);
+    EXPECT_EQ(span.subspan(1, 3)[2], 3);
+    EXPECT_EQ(span.subspan(4).size(), 2U);
+
+    ara::core::Span<int, 6> fixed(raw);
+    auto tail = fixed.subspan<2>();
+    EXPECT_EQ(decltype(tail)::extent, 4U);
+    EXPECT_EQ(tail[0], 2);
+    auto head = fixed.first<3>();
+    EXPECT_EQ(decltype(head)::extent, 3U);
+    EXPECT_EQ(fixed.last<1>()[0], 5);
+}
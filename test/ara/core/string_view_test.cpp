@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include "ara/core/string.h"
+#include "ara/core/string_view.h"
+
+TEST(StringViewTest, ViewsStringsAndLiterals)
+{
+    ara::core::String const string{"key/value"};
+    ara::core::StringView view = string;
+    EXPECT_EQ(view.size(), 9U);
+    EXPECT_EQ(view.data(), string.data());
+    EXPECT_TRUE(view == "key/value");
+    EXPECT_TRUE(view != "key");
+    EXPECT_TRUE(ara::core::StringView("abc") < ara::core::StringView("abd"));
+    EXPECT_TRUE(ara::core::StringView("ab") < ara::core::StringView("abc"));
+    EXPECT_TRUE(ara::core::StringView().empty());
+}
+
+TEST(StringViewTest, SearchAndSlice)
+{
+    ara::core::StringView view{"key/value/key"};
+    EXPECT_EQ(view.find('/'), 3U);
+    EXPECT_EQ(view.rfind('/'), 9U);
+    EXPECT_EQ(view.find("key", 1U), 10U);
+    EXPECT_EQ(view.find("absent"), ara::core::StringView::npos);
+    EXPECT_TRUE(view.substr(4U, 5U) == "value");
+    EXPECT_TRUE(view.starts_with("key/"));
+    EXPECT_TRUE(view.ends_with("/key"));
+    EXPECT_THROW(view.substr(20U), std::out_of_range);
+
+    view.remove_prefix(4U);
+    view.remove_suffix(4U);
+    EXPECT_TRUE(view == "value");
+}
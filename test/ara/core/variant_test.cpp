@@ -0,0 +1,109 @@
+#include <memory>
+#include <stdexcept>
+#include <gtest/gtest.h>
+#include "ara/core/string.h"
+#include "ara/core/variant.h"
+#include "ara/core/vector.h"
+
+namespace
+{
+    struct ThrowOnCopy
+    {
+        ThrowOnCopy() = default;
+
+        ThrowOnCopy(ThrowOnCopy const &)
+        {
+            throw std::runtime_error("copy");
+        }
+    };
+
+    struct Length
+    {
+        std::size_t operator()(int) const
+        {
+            return 1U;
+        }
+
+        std::size_t operator()(ara::core::String const &value) const
+        {
+            return value.size();
+        }
+    };
+}
+
+TEST(VariantTest, DefaultConstructsFirstAlternative)
+{
+    ara::core::Variant<int, ara::core::String> value;
+    EXPECT_EQ(value.index(), 0U);
+    EXPECT_EQ(ara::core::get<0>(value), 0);
+}
+
+TEST(VariantTest, ConvertingConstructorSelectsAlternative)
+{
+    ara::core::Variant<int, ara::core::String> number{42};
+    ara::core::Variant<int, ara::core::String> text{"abc"};
+    EXPECT_EQ(number.index(), 0U);
+    EXPECT_EQ(text.index(), 1U);
+    EXPECT_TRUE(ara::core::holds_alternative<ara::core::String>(text));
+    EXPECT_EQ(ara::core::get<ara::core::String>(text), "abc");
+    EXPECT_EQ(ara::core::get_if<1>(&number), nullptr);
+}
+
+TEST(VariantTest, AssignmentAndEmplaceSwitchAlternative)
+{
+    ara::core::Variant<int, ara::core::String, ara::core::Vector<int>> value{1};
+    value = ara::core::String("x");
+    EXPECT_EQ(value.index(), 1U);
+    value.emplace<2>(3U, 7);
+    EXPECT_EQ(ara::core::get<2>(value).size(), 3U);
+    value.emplace<int>(9);
+    EXPECT_EQ(ara::core::get<int>(value), 9);
+}
+
+TEST(VariantTest, CopyMoveCompareAndSwap)
+{
+    ara::core::Variant<int, ara::core::String> a{ara::core::String("left")};
+    ara::core::Variant<int, ara::core::String> b{a};
+    EXPECT_EQ(a, b);
+
+    ara::core::Variant<int, ara::core::String> c{3};
+    EXPECT_TRUE(c < a);
+    c.swap(b);
+    EXPECT_EQ(ara::core::get<1>(c), "left");
+    EXPECT_EQ(ara::core::get<0>(b), 3);
+
+    ara::core::Variant<std::unique_ptr<int>, int> owner{std::unique_ptr<int>(new int(5))};
+    ara::core::Variant<std::unique_ptr<int>, int> moved{std::move(owner)};
+    EXPECT_EQ(*ara::core::get<0>(moved), 5);
+}
+
+TEST(VariantTest, InPlaceConstruction)
+{
+    ara::core::Variant<int, ara::core::String> byIndex{ara::core::in_place_index<1>, 2U, 'z'};
+    EXPECT_EQ(ara::core::get<1>(byIndex), "zz");
+    ara::core::Variant<int, ara::core::String> byType{ara::core::in_place_type<ara::core::String>, "q"};
+    EXPECT_EQ(ara::core::get<1>(byType), "q");
+}
+
+TEST(VariantTest, VisitDispatchesOnIndex)
+{
+    ara::core::Variant<int, ara::core::String> value{ara::core::String("four")};
+    EXPECT_EQ(ara::core::visit(Length{}, value), 4U);
+    value = 1;
+    EXPECT_EQ(ara::core::visit(Length{}, value), 1U);
+}
+
+TEST(VariantTest, ThrowingConstructionLeavesNoValue)
+{
+    ThrowOnCopy source;
+    ara::core::Variant<int, ThrowOnCopy> value{1};
+    EXPECT_THROW(value.emplace<1>(source), std::runtime_error);
+    EXPECT_TRUE(value.valueless_by_exception());
+    EXPECT_EQ(value.index(), ara::core::variant_npos);
+}
+
+TEST(VariantTest, GetOfOtherAlternativeTerminates)
+{
+    ara::core::Variant<int, ara::core::String> value{1};
+    EXPECT_DEATH(static_cast<void>(ara::core::get<1>(value)), "");
+}